@@ -8,12 +8,24 @@
 #include "net/AllocatedSocketAddress.hxx"
 #include "util/StaticVector.hxx"
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 struct Action {
 	static constexpr unsigned MAX_EXEC = 32;
 	static constexpr unsigned MAX_ENV = 32;
 
+	/**
+	 * The maximum number of actions in a #FANOUT.
+	 */
+	static constexpr unsigned MAX_FANOUT = 8;
+
+	/**
+	 * The maximum number of recipient groups in a #SPLIT.
+	 */
+	static constexpr unsigned MAX_SPLIT = 32;
+
 	enum class Type {
 		UNDEFINED,
 
@@ -42,6 +54,22 @@ struct Action {
 		 * stdin.  The envelope is ignored.
 		 */
 		EXEC_RAW,
+
+		/**
+		 * Perform all actions in #actions concurrently.  The
+		 * first one (the primary) determines the response;
+		 * the others (the secondaries) continue in the
+		 * background.
+		 */
+		FANOUT,
+
+		/**
+		 * Split the recipients into groups, each with its own
+		 * action (in #actions); they are performed
+		 * concurrently, and their responses are combined into
+		 * one.
+		 */
+		SPLIT,
 	};
 
 	Type type = Type::UNDEFINED;
@@ -55,8 +83,31 @@ struct Action {
 	 */
 	StaticVector<std::string, MAX_ENV> env;
 
+	/**
+	 * For #FANOUT, this is the default timeout of the
+	 * secondaries.
+	 */
 	Event::Duration timeout{-1};
 
+	/**
+	 * The actions of a #FANOUT (the first one is the primary) or
+	 * a #SPLIT.  None of them is a #FANOUT or a #SPLIT.
+	 */
+	std::vector<Action> actions;
+
+	/**
+	 * For the actions of a #SPLIT: the indexes of the
+	 * QmqpMail::recipients of this group.
+	 */
+	std::vector<std::size_t> recipients;
+
+	/**
+	 * For #SPLIT: the MutableMail::id of the mail which created
+	 * this action; the recipient indexes are only valid for that
+	 * mail.
+	 */
+	uint_least64_t mail_id = 0;
+
 	bool IsDefined() const {
 		return type != Type::UNDEFINED;
 	}
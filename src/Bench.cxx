@@ -0,0 +1,397 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "Bench.hxx"
+#include "Instance.hxx"
+#include "MutableMail.hxx"
+#include "LMail.hxx"
+#include "LAction.hxx"
+#include "Action.hxx"
+#include "lib/fmt/RuntimeError.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "lua/AutoCloseList.hxx"
+#include "lua/CoRunner.hxx"
+#include "lua/Resume.hxx"
+#include "lua/Value.hxx"
+#include "net/linux/PeerAuth.hxx"
+#include "net/SocketAddress.hxx"
+#include "net/UniqueSocketDescriptor.hxx"
+#include "util/PrintException.hxx"
+#include "util/ScopeExit.hxx"
+#include "util/StringSplit.hxx"
+#include "config.h"
+
+#ifdef HAVE_LIBSODIUM
+#include "BodyHasher.hxx"
+#endif
+
+extern "C" {
+#include <lua.h>
+}
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using std::string_view_literals::operator""sv;
+
+static std::string
+ReadFileAt(int directory_fd, const char *name)
+{
+	const int fd = openat(directory_fd, name, O_RDONLY|O_CLOEXEC);
+	if (fd < 0)
+		throw FmtErrno("Failed to open {}", name);
+
+	AtScopeExit(fd) { close(fd); };
+
+	std::string result;
+	std::array<char, 65536> buffer;
+
+	while (true) {
+		const auto nbytes = read(fd, buffer.data(), buffer.size());
+		if (nbytes < 0)
+			throw FmtErrno("Failed to read {}", name);
+
+		if (nbytes == 0)
+			break;
+
+		result.append(buffer.data(), static_cast<std::size_t>(nbytes));
+	}
+
+	return result;
+}
+
+static void
+AppendNetstring(std::string &dest, std::string_view value) noexcept
+{
+	fmt::format_to(std::back_inserter(dest), "{}:"sv, value.size());
+	dest.append(value);
+	dest.push_back(',');
+}
+
+/**
+ * Convert a file written by test/record.py (sender and recipients
+ * on one line each, an empty line, then the message) to a QMQP
+ * payload.
+ */
+static std::string
+RecordToQmqp(std::string_view record)
+{
+	const auto separator = record.find("\n\n"sv);
+	if (separator == record.npos)
+		throw std::runtime_error("No envelope separator");
+
+	const auto envelope = record.substr(0, separator);
+	const auto message = record.substr(separator + 2);
+
+	auto [sender, recipients] = Split(envelope, '\n');
+
+	std::string payload;
+	AppendNetstring(payload, message);
+	AppendNetstring(payload, sender);
+
+	while (!recipients.empty()) {
+		const auto [recipient, rest] = Split(recipients, '\n');
+		if (!recipient.empty())
+			AppendNetstring(payload, recipient);
+		recipients = rest;
+	}
+
+	return payload;
+}
+
+std::vector<BenchMail>
+LoadBenchCorpus(const char *path)
+{
+	DIR *dir = opendir(path);
+	if (dir == nullptr)
+		throw FmtErrno("Failed to open {}", path);
+
+	AtScopeExit(dir) { closedir(dir); };
+
+	std::vector<BenchMail> corpus;
+
+	while (const auto *e = readdir(dir)) {
+		if (e->d_name[0] == '.' || e->d_type == DT_DIR)
+			continue;
+
+		try {
+			corpus.push_back({
+				.name = e->d_name,
+				.payload = RecordToQmqp(ReadFileAt(dirfd(dir), e->d_name)),
+			});
+		} catch (...) {
+			std::throw_with_nested(FmtRuntimeError("Failed to load {}", e->d_name));
+		}
+	}
+
+	if (corpus.empty())
+		throw FmtRuntimeError("No mails in {}", path);
+
+	/* make the order (and thus the results) reproducible */
+	std::sort(corpus.begin(), corpus.end(), [](const auto &a, const auto &b){
+		return a.name < b.name;
+	});
+
+	return corpus;
+}
+
+/**
+ * Runs one handler invocation to completion, running the
+ * #EventLoop if the handler yields.
+ */
+class BenchRunner final : Lua::ResumeListener {
+	EventLoop &event_loop;
+
+	std::exception_ptr error;
+
+	Action::Type result;
+
+	bool finished = false, running = false;
+
+public:
+	explicit BenchRunner(EventLoop &_event_loop) noexcept
+		:event_loop(_event_loop) {}
+
+	Lua::ResumeListener &GetListener() noexcept {
+		return *this;
+	}
+
+	/**
+	 * Throws if the handler fails.
+	 */
+	Action::Type Run(lua_State *L) {
+		Lua::Resume(L, 1);
+
+		if (!finished) {
+			running = true;
+			event_loop.Run();
+			running = false;
+
+			if (!finished)
+				throw std::runtime_error("Handler did not finish");
+		}
+
+		if (error)
+			std::rethrow_exception(error);
+
+		return result;
+	}
+
+private:
+	void Finished() noexcept {
+		finished = true;
+		if (running)
+			event_loop.Break();
+	}
+
+	/* virtual methods from class Lua::ResumeListener */
+	void OnLuaFinished(lua_State *L) noexcept override {
+		const auto *action = CheckLuaAction(L, -1);
+		if (action != nullptr)
+			result = action->type;
+		else
+			error = std::make_exception_ptr(std::runtime_error("Wrong return type from Lua handler"));
+
+		Finished();
+	}
+
+	void OnLuaError(lua_State *, std::exception_ptr &&_error) noexcept override {
+		error = std::move(_error);
+		Finished();
+	}
+};
+
+static constexpr std::string_view
+ToString(Action::Type type) noexcept
+{
+	switch (type) {
+	case Action::Type::UNDEFINED:
+		break;
+
+	case Action::Type::DISCARD:
+		return "discard"sv;
+
+	case Action::Type::REJECT:
+		return "reject"sv;
+
+	case Action::Type::CONNECT:
+		return "connect"sv;
+
+	case Action::Type::EXEC:
+		return "exec"sv;
+
+	case Action::Type::EXEC_RAW:
+		return "exec_raw"sv;
+
+	case Action::Type::FANOUT:
+		return "fanout"sv;
+
+	case Action::Type::SPLIT:
+		return "split"sv;
+	}
+
+	return "undefined"sv;
+}
+
+static std::size_t
+GetLuaHeapBytes(lua_State *L) noexcept
+{
+	return static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 +
+		static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNTB, 0));
+}
+
+static constexpr double
+ToMicroseconds(Event::Duration d) noexcept
+{
+	return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(d).count();
+}
+
+[[gnu::pure]]
+static Event::Duration
+Percentile(const std::vector<Event::Duration> &sorted, double p) noexcept
+{
+	const std::size_t i = std::min(static_cast<std::size_t>(static_cast<double>(sorted.size()) * p),
+				       sorted.size() - 1);
+	return sorted[i];
+}
+
+struct BenchResult {
+	std::vector<Event::Duration> latencies;
+	std::map<std::string_view, unsigned> actions;
+
+	std::size_t total_allocated = 0, max_allocated = 0;
+
+	Event::Duration gc_time{};
+
+	unsigned n_malformed = 0, n_failed = 0;
+
+	void Print(const std::string &name) noexcept;
+};
+
+void
+BenchResult::Print(const std::string &name) noexcept
+{
+	fmt::print("handler {}: {} mails, {} malformed, {} failed\n"sv,
+		   name, latencies.size(), n_malformed, n_failed);
+
+	if (latencies.empty())
+		return;
+
+	std::sort(latencies.begin(), latencies.end());
+
+	const auto n = latencies.size();
+	fmt::print("  latency [us]: p50={:.1f} p90={:.1f} p99={:.1f} max={:.1f}\n"sv,
+		   ToMicroseconds(Percentile(latencies, 0.5)),
+		   ToMicroseconds(Percentile(latencies, 0.9)),
+		   ToMicroseconds(Percentile(latencies, 0.99)),
+		   ToMicroseconds(latencies.back()));
+	fmt::print("  Lua allocations [bytes/mail]: avg={} max={}\n"sv,
+		   total_allocated / n, max_allocated);
+	fmt::print("  Lua GC [us/mail]: {:.1f}\n"sv,
+		   ToMicroseconds(gc_time) / static_cast<double>(n));
+
+	for (const auto &[action, count] : actions)
+		fmt::print("  action {}: {}\n"sv, action, count);
+}
+
+static void
+RunBench(Instance &instance, const DryRunHandler &handler,
+	 const std::vector<BenchMail> &corpus,
+	 const SocketPeerAuth &peer_auth)
+{
+	const auto L = instance.GetLuaState();
+
+	BenchResult result;
+
+	for (const auto &i : corpus) {
+		AllocatedArray<std::byte> buffer{i.payload.size()};
+		std::copy_n(reinterpret_cast<const std::byte *>(i.payload.data()),
+			    i.payload.size(), buffer.data());
+
+		MutableMail mail{std::move(buffer)};
+		if (mail.Parse() != QmqpMail::ParseResult::SUCCESS) {
+			++result.n_malformed;
+			continue;
+		}
+
+#ifdef HAVE_LIBSODIUM
+		if (handler.config.body_hash) {
+			BodyHasher hasher;
+			hasher.Feed(mail.message);
+			mail.body_hash = hasher.Finish();
+		}
+#endif
+
+		Lua::AutoCloseList auto_close{L};
+		Lua::CoRunner thread{L};
+		BenchRunner runner{instance.GetEventLoop()};
+
+		const auto T = thread.CreateThread(runner.GetListener());
+		handler.handler->Push(T);
+		NewLuaMail(T, auto_close, std::move(mail), &peer_auth,
+			   nullptr, instance, nullptr);
+
+		/* the collector is stopped, therefore the heap growth
+		   is the amount allocated by the handler */
+		const std::size_t heap_before = GetLuaHeapBytes(L);
+		const auto start = Event::Clock::now();
+
+		try {
+			const auto type = runner.Run(T);
+			++result.actions[ToString(type)];
+		} catch (...) {
+			++result.n_failed;
+			fmt::print(stderr, "{}: "sv, i.name);
+			PrintException(std::current_exception());
+		}
+
+		result.latencies.push_back(Event::Clock::now() - start);
+
+		const std::size_t heap_after = GetLuaHeapBytes(L);
+		const std::size_t allocated = heap_after > heap_before
+			? heap_after - heap_before
+			: 0;
+		result.total_allocated += allocated;
+		result.max_allocated = std::max(result.max_allocated, allocated);
+
+		thread.Cancel();
+
+		/* collect the garbage produced by this handler
+		   invocation */
+		const auto gc_start = Event::Clock::now();
+		lua_gc(L, LUA_GCSTEP, static_cast<int>(allocated / 1024 + 1));
+		lua_gc(L, LUA_GCSTOP, 0);
+		result.gc_time += Event::Clock::now() - gc_start;
+	}
+
+	result.Print(handler.config.name);
+}
+
+void
+RunBench(Instance &instance, const std::vector<BenchMail> &corpus)
+{
+	/* the Lua mail object wants the credentials of a peer; use a
+	   socket pair connected to ourselves */
+	int fds[2];
+	if (socketpair(AF_LOCAL, SOCK_STREAM|SOCK_CLOEXEC, 0, fds) < 0)
+		throw MakeErrno("socketpair() failed");
+
+	const UniqueSocketDescriptor a{AdoptTag{}, fds[0]}, b{AdoptTag{}, fds[1]};
+	const SocketPeerAuth peer_auth{a};
+
+	const auto L = instance.GetLuaState();
+	lua_gc(L, LUA_GCCOLLECT, 0);
+	lua_gc(L, LUA_GCSTOP, 0);
+
+	for (const auto &i : instance.GetDryRunHandlers())
+		RunBench(instance, i, corpus, peer_auth);
+}
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class Instance;
+
+/**
+ * A recorded submission (in the format written by test/record.py)
+ * converted to a QMQP payload.
+ */
+struct BenchMail {
+	std::string name;
+	std::string payload;
+};
+
+/**
+ * Load all recorded submissions from the specified directory.
+ *
+ * Throws on error.
+ */
+std::vector<BenchMail>
+LoadBenchCorpus(const char *path);
+
+/**
+ * Feed all mails through all Lua handlers (which must have been
+ * registered in "dry run" mode) without relaying them, and print a
+ * report to stdout.
+ */
+void
+RunBench(Instance &instance, const std::vector<BenchMail> &corpus);
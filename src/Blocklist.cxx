@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "Blocklist.hxx"
+
+#include <vector>
+
+Blocklist::Blocklist(const char *path)
+	:cdb(path)
+{
+	std::vector<uint_least64_t> hashes;
+	cdb.ForEach([&hashes](std::string_view key, std::string_view){
+		hashes.push_back(XorFilter::Hash(key));
+	});
+
+	filter = XorFilter{hashes};
+}
+
+bool
+Blocklist::ContainsAddress(std::string_view address) const noexcept
+{
+	if (Contains(address))
+		return true;
+
+	const auto at = address.rfind('@');
+	return at != address.npos && Contains(address.substr(at + 1));
+}
+
+std::size_t
+Blocklist::FindAny(std::span<const std::string_view> addresses) const noexcept
+{
+	for (std::size_t i = 0; i < addresses.size(); ++i)
+		if (ContainsAddress(addresses[i]))
+			return i;
+
+	return SIZE_MAX;
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "djb/CdbFile.hxx"
+#include "util/XorFilter.hxx"
+
+#include <span>
+#include <string_view>
+
+/**
+ * A large set of email addresses and domains.  The keys of a CDB
+ * file are the exact set; an #XorFilter built from them when the
+ * file is loaded rejects most non-members with three memory
+ * accesses, so the CDB is consulted only for (probable) members.
+ */
+class Blocklist {
+	CdbFile cdb;
+
+	XorFilter filter;
+
+public:
+	Blocklist() noexcept = default;
+
+	/**
+	 * Load the CDB file and build the filter.  Throws on error.
+	 */
+	explicit Blocklist(const char *path);
+
+	Blocklist(Blocklist &&) noexcept = default;
+	Blocklist &operator=(Blocklist &&) noexcept = default;
+
+	std::size_t GetFilterMemorySize() const noexcept {
+		return filter.GetMemorySize();
+	}
+
+	[[gnu::pure]]
+	bool Contains(std::string_view key) const noexcept {
+		return filter.MayContain(XorFilter::Hash(key)) &&
+			cdb.Find(key);
+	}
+
+	/**
+	 * Check whether the address or its domain (the part after
+	 * the last '@') is in the set.
+	 */
+	[[gnu::pure]]
+	bool ContainsAddress(std::string_view address) const noexcept;
+
+	/**
+	 * Find the first address for which ContainsAddress() is
+	 * true.
+	 *
+	 * @return the index or SIZE_MAX if none was found
+	 */
+	[[gnu::pure]]
+	std::size_t FindAny(std::span<const std::string_view> addresses) const noexcept;
+};
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "BlocklistLoader.hxx"
+#include "system/Error.hxx"
+
+#include <cstdint>
+#include <span>
+
+#include <sys/eventfd.h>
+
+BlocklistLoader::BlocklistLoader(EventLoop &event_loop, const char *_path,
+				 BlocklistLoaderHandler &_handler)
+	:event(event_loop, BIND_THIS_METHOD(OnEventReady)),
+	 handler(_handler),
+	 path(_path)
+{
+	const int fd = eventfd(0, EFD_NONBLOCK|EFD_CLOEXEC);
+	if (fd < 0)
+		throw MakeErrno("eventfd() failed");
+
+	event.Open(FileDescriptor{fd});
+	event.ScheduleRead();
+
+	thread = std::thread{&BlocklistLoader::Run, this};
+}
+
+BlocklistLoader::~BlocklistLoader() noexcept
+{
+	if (thread.joinable())
+		/* this blocks until the filter has been built; there
+		   is no way to interrupt that */
+		thread.join();
+
+	event.Close();
+}
+
+void
+BlocklistLoader::Run() noexcept
+{
+	try {
+		result = Blocklist{path.c_str()};
+	} catch (...) {
+		error = std::current_exception();
+	}
+
+	static constexpr uint64_t one = 1;
+	(void)event.GetFileDescriptor().Write(std::as_bytes(std::span{&one, 1}));
+}
+
+void
+BlocklistLoader::OnEventReady(unsigned) noexcept
+{
+	/* the helper thread is about to exit, so this doesn't
+	   block */
+	thread.join();
+	event.Cancel();
+
+	/* the handler may destroy this object */
+	if (error)
+		handler.OnBlocklistError(std::move(error));
+	else
+		handler.OnBlocklistLoaded(std::move(result));
+}
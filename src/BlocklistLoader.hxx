@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "Blocklist.hxx"
+#include "event/PipeEvent.hxx"
+
+#include <exception>
+#include <string>
+#include <thread>
+
+class BlocklistLoaderHandler {
+public:
+	virtual void OnBlocklistLoaded(Blocklist &&blocklist) noexcept = 0;
+	virtual void OnBlocklistError(std::exception_ptr error) noexcept = 0;
+};
+
+/**
+ * Loads a #Blocklist without blocking the #EventLoop: reading the
+ * file and building the #XorFilter runs on a helper thread which
+ * reports completion through an eventfd.  The result is passed to
+ * the #BlocklistLoaderHandler on the #EventLoop thread.
+ */
+class BlocklistLoader final {
+	PipeEvent event;
+
+	BlocklistLoaderHandler &handler;
+
+	const std::string path;
+
+	/**
+	 * The result of the helper thread.  These are only accessed
+	 * by the #EventLoop thread after the helper thread has been
+	 * joined.
+	 */
+	Blocklist result;
+	std::exception_ptr error;
+
+	std::thread thread;
+
+public:
+	/**
+	 * Start loading the file.  Throws on error.
+	 */
+	BlocklistLoader(EventLoop &event_loop, const char *_path,
+			BlocklistLoaderHandler &_handler);
+
+	/**
+	 * Cancel loading.  This may block until the helper thread
+	 * has finished.
+	 */
+	~BlocklistLoader() noexcept;
+
+	BlocklistLoader(const BlocklistLoader &) = delete;
+	BlocklistLoader &operator=(const BlocklistLoader &) = delete;
+
+private:
+	void Run() noexcept;
+
+	void OnEventReady(unsigned events) noexcept;
+};
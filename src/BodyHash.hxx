@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * A (BLAKE2b) hash of a message body, i.e. everything after the
+ * first empty line, computed by #BodyHasher.
+ */
+using BodyHash = std::array<std::byte, 16>;
+
+/**
+ * Format the #BodyHash as a lower-case hexadecimal string.
+ */
+constexpr std::array<char, sizeof(BodyHash) * 2>
+FormatBodyHash(const BodyHash &hash) noexcept
+{
+	constexpr std::string_view hex_digits = "0123456789abcdef";
+
+	std::array<char, sizeof(BodyHash) * 2> result{};
+	for (std::size_t i = 0; i < hash.size(); ++i) {
+		const auto b = static_cast<unsigned>(hash[i]);
+		result[i * 2] = hex_digits[b >> 4];
+		result[i * 2 + 1] = hex_digits[b & 0xf];
+	}
+
+	return result;
+}
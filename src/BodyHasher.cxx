@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "BodyHasher.hxx"
+#include "HeaderIndex.hxx"
+
+#include <cassert>
+
+using std::string_view_literals::operator""sv;
+
+BodyHasher::BodyHasher() noexcept
+{
+	crypto_generichash_init(&state, nullptr, 0, sizeof(BodyHash));
+}
+
+inline std::string_view
+BodyHasher::SkipHeader(std::string_view data) noexcept
+{
+	while (!data.empty()) {
+		switch (header_state) {
+		case HeaderState::LINE:
+			if (const auto lf = data.find('\n'); lf != data.npos) {
+				data.remove_prefix(lf + 1);
+				header_state = HeaderState::LF;
+			} else
+				return {};
+
+			break;
+
+		case HeaderState::LF:
+			if (data.front() == '\n')
+				header_state = HeaderState::BODY;
+			else if (data.front() == '\r')
+				header_state = HeaderState::LF_CR;
+			else
+				header_state = HeaderState::LINE;
+
+			data.remove_prefix(1);
+			break;
+
+		case HeaderState::LF_CR:
+			if (data.front() == '\n') {
+				header_state = HeaderState::BODY;
+				data.remove_prefix(1);
+			} else
+				header_state = HeaderState::LINE;
+
+			break;
+
+		case HeaderState::BODY:
+			return data;
+		}
+	}
+
+	return data;
+}
+
+void
+BodyHasher::Feed(std::string_view message) noexcept
+{
+	assert(message.size() >= position);
+
+	auto data = message.substr(position);
+	position = message.size();
+
+	if (header_state != HeaderState::BODY) {
+		data = SkipHeader(data);
+		if (header_state != HeaderState::BODY)
+			return;
+	}
+
+	if (!data.empty())
+		crypto_generichash_update(&state,
+					  reinterpret_cast<const unsigned char *>(data.data()),
+					  data.size());
+}
+
+BodyHash
+BodyHasher::Finish() noexcept
+{
+	BodyHash hash;
+	crypto_generichash_final(&state,
+				 reinterpret_cast<unsigned char *>(hash.data()),
+				 hash.size());
+	return hash;
+}
+
+static void
+UpdateString(crypto_generichash_state &state, std::string_view s) noexcept
+{
+	/* include the null terminator to separate the strings */
+	crypto_generichash_update(&state,
+				  reinterpret_cast<const unsigned char *>(s.data()),
+				  s.size());
+	crypto_generichash_update(&state,
+				  reinterpret_cast<const unsigned char *>(""),
+				  1);
+}
+
+/**
+ * Is this a header field which a client may generate anew when it
+ * retransmits a mail?
+ */
+[[gnu::pure]]
+static bool
+IsVolatileHeader(std::string_view name) noexcept
+{
+	return IsSameHeaderName(name, "Date"sv) ||
+		IsSameHeaderName(name, "Message-ID"sv) ||
+		IsSameHeaderName(name, "Received"sv);
+}
+
+BodyHash
+HashEnvelope(const BodyHash &body_hash, const HeaderIndex &header,
+	     std::string_view sender,
+	     std::span<const std::string_view> recipients) noexcept
+{
+	crypto_generichash_state state;
+	crypto_generichash_init(&state, nullptr, 0, sizeof(BodyHash));
+
+	crypto_generichash_update(&state,
+				  reinterpret_cast<const unsigned char *>(body_hash.data()),
+				  body_hash.size());
+
+	for (const auto &i : header.GetFields()) {
+		if (IsVolatileHeader(i.name))
+			continue;
+
+		UpdateString(state, i.name);
+		UpdateString(state, i.value);
+	}
+
+	/* separate the header from the envelope */
+	UpdateString(state, {});
+
+	UpdateString(state, sender);
+	for (const auto &i : recipients)
+		UpdateString(state, i);
+
+	BodyHash hash;
+	crypto_generichash_final(&state,
+				 reinterpret_cast<unsigned char *>(hash.data()),
+				 hash.size());
+	return hash;
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "BodyHash.hxx"
+
+#include <sodium/crypto_generichash.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+/**
+ * Calculates the #BodyHash of a message incrementally while it is
+ * being received.  The header block is skipped, so messages which
+ * differ only in their headers (e.g. "Date" and "Message-ID") get
+ * the same hash.  A message without an empty line has an empty
+ * body.
+ */
+class BodyHasher {
+	crypto_generichash_state state;
+
+	/**
+	 * The number of message bytes already processed.
+	 */
+	std::size_t position = 0;
+
+	enum class HeaderState : uint_least8_t {
+		/**
+		 * Inside a header line.
+		 */
+		LINE,
+
+		/**
+		 * At the beginning of a line.
+		 */
+		LF,
+
+		/**
+		 * After a carriage return at the beginning of a
+		 * line.
+		 */
+		LF_CR,
+
+		/**
+		 * The header block has ended.
+		 */
+		BODY,
+	} header_state = HeaderState::LF;
+
+public:
+	BodyHasher() noexcept;
+
+	BodyHasher(const BodyHasher &) = delete;
+	BodyHasher &operator=(const BodyHasher &) = delete;
+
+	/**
+	 * Process newly received message data.
+	 *
+	 * @param message all of the message received so far; only
+	 * the part which was not passed to previous calls is
+	 * processed
+	 */
+	void Feed(std::string_view message) noexcept;
+
+	/**
+	 * Finish the calculation.  This object must not be used
+	 * afterwards.
+	 */
+	BodyHash Finish() noexcept;
+
+private:
+	/**
+	 * Skip header lines.
+	 *
+	 * @return the data after the header block
+	 */
+	std::string_view SkipHeader(std::string_view data) noexcept;
+};
+
+class HeaderIndex;
+
+/**
+ * Combine the #BodyHash with the header and the envelope into one
+ * hash which identifies a submission (e.g. for #DuplicateCache).
+ * Header fields which differ between retransmissions of the same
+ * mail ("Date", "Message-ID", "Received") are omitted; all others
+ * (e.g. "Subject") are included, so mails which differ only in
+ * those get different hashes.
+ *
+ * @param header the header of the message as received from the
+ * client (i.e. without headers inserted by the Lua handler)
+ */
+[[gnu::pure]]
+BodyHash
+HashEnvelope(const BodyHash &body_hash, const HeaderIndex &header,
+	     std::string_view sender,
+	     std::span<const std::string_view> recipients) noexcept;
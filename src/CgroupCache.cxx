@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "CgroupCache.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "io/Open.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+
+#include <array>
+#include <optional>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/xattr.h>
+
+using std::string_view_literals::operator""sv;
+
+static constexpr std::string_view CGROUP_ROOT = "/sys/fs/cgroup"sv;
+
+CgroupCache::CgroupCache(EventLoop &event_loop) noexcept
+	:inotify_event(event_loop, BIND_THIS_METHOD(OnInotifyReady))
+{
+	const int fd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
+	if (fd < 0)
+		/* without inotify, we cannot invalidate, so nothing
+		   will be cached */
+		return;
+
+	inotify_event.Open(FileDescriptor{fd});
+	inotify_event.ScheduleRead();
+}
+
+CgroupCache::~CgroupCache() noexcept
+{
+	inotify_event.Close();
+}
+
+void
+CgroupCache::Disable() noexcept
+{
+	Flush();
+	inotify_event.Close();
+}
+
+/**
+ * Read the value of an extended attribute of arbitrary size.
+ *
+ * @return the value or std::nullopt if the attribute has been
+ * removed meanwhile
+ */
+static std::optional<std::string>
+ReadXattr(FileDescriptor fd, const char *name)
+{
+	std::array<char, 4096> buffer;
+	auto length = fgetxattr(fd.Get(), name, buffer.data(), buffer.size());
+	if (length >= 0)
+		return std::string{buffer.data(), std::size_t(length)};
+
+	/* too large for the buffer: ask the kernel for the size and
+	   try again (the value may grow meanwhile) */
+	while (errno == ERANGE) {
+		length = fgetxattr(fd.Get(), name, nullptr, 0);
+		if (length < 0)
+			break;
+
+		std::string value(std::size_t(length), '\0');
+		length = fgetxattr(fd.Get(), name, value.data(), value.size());
+		if (length >= 0) {
+			value.resize(std::size_t(length));
+			return value;
+		}
+	}
+
+	return std::nullopt;
+}
+
+static void
+ReadXattrs(FileDescriptor fd, const char *path,
+	   std::map<std::string, std::string, std::less<>> &dest)
+{
+	std::array<char, 4096> names;
+	const auto nbytes = flistxattr(fd.Get(), names.data(), names.size());
+	if (nbytes < 0) {
+		if (errno == ENOTSUP)
+			return;
+
+		throw FmtErrno("Failed to list extended attributes of {}",
+			       path);
+	}
+
+	const char *const end = names.data() + nbytes;
+	for (const char *name = names.data(); name < end;
+	     name += strlen(name) + 1) {
+		auto value = ReadXattr(fd, name);
+		if (!value)
+			/* removed meanwhile; ignore */
+			continue;
+
+		dest.emplace(name, std::move(*value));
+	}
+}
+
+std::shared_ptr<CgroupCache::Entry>
+CgroupCache::Load(std::string_view path)
+{
+	auto entry = std::make_shared<Entry>();
+	entry->path = path;
+
+	if (path != "/"sv) {
+		const auto slash = path.rfind('/');
+		if (slash != path.npos)
+			entry->parent = Lookup(slash == 0
+					       ? "/"sv
+					       : path.substr(0, slash));
+	}
+
+	std::string full_path{CGROUP_ROOT};
+	full_path.append(path);
+
+	/* add the watch before reading the attributes, or else we
+	   might miss a modification */
+	int watch = -1;
+	if (inotify_event.IsDefined())
+		watch = inotify_add_watch(inotify_event.GetFileDescriptor().Get(),
+					  full_path.c_str(),
+					  IN_ATTRIB|IN_DELETE_SELF|IN_MOVE_SELF|IN_ONLYDIR);
+
+	try {
+		ReadXattrs(OpenDirectory(full_path.c_str()), full_path.c_str(),
+			   entry->xattr);
+	} catch (...) {
+		/* don't leak the watch (unless it was already owned
+		   by another item, because inotify_add_watch()
+		   returns the existing descriptor for an inode which
+		   is already being watched) */
+		if (watch >= 0 && !watches.contains(watch))
+			inotify_rm_watch(inotify_event.GetFileDescriptor().Get(),
+					 watch);
+		throw;
+	}
+
+	if (watch >= 0) {
+		watches.insert_or_assign(watch, entry->path);
+		items.insert_or_assign(entry->path, Item{entry, watch});
+	}
+
+	return entry;
+}
+
+std::shared_ptr<const CgroupCache::Entry>
+CgroupCache::Lookup(std::string_view path)
+{
+	if (auto i = items.find(path); i != items.end()) {
+		if (i->second.entry->IsValid())
+			return i->second.entry;
+
+		/* a parent has been invalidated; reload this one,
+		   too */
+		Invalidate(i->second.watch);
+	}
+
+	return Load(path);
+}
+
+std::shared_ptr<const CgroupCache::Entry>
+CgroupCache::Get(std::string_view path)
+{
+	if (auto i = items.find(path);
+	    i != items.end() && i->second.entry->IsValid()) [[likely]] {
+		++n_hits;
+		return i->second.entry;
+	}
+
+	++n_misses;
+
+	if (items.size() >= MAX_ENTRIES) [[unlikely]]
+		Flush();
+
+	return Lookup(path);
+}
+
+void
+CgroupCache::Flush() noexcept
+{
+	for (auto &[path, item] : items) {
+		item.entry->valid = false;
+		inotify_rm_watch(inotify_event.GetFileDescriptor().Get(),
+				 item.watch);
+	}
+
+	items.clear();
+	watches.clear();
+}
+
+void
+CgroupCache::Invalidate(int watch) noexcept
+{
+	const auto w = watches.find(watch);
+	if (w == watches.end())
+		return;
+
+	if (const auto i = items.find(w->second); i != items.end()) {
+		i->second.entry->valid = false;
+		items.erase(i);
+	}
+
+	watches.erase(w);
+
+	/* this fails with EINVAL if the kernel has already removed
+	   the watch (IN_IGNORED); that's fine */
+	inotify_rm_watch(inotify_event.GetFileDescriptor().Get(), watch);
+
+	++n_invalidations;
+}
+
+void
+CgroupCache::OnInotifyReady(unsigned) noexcept
+{
+	alignas(struct inotify_event) std::array<std::byte, 4096> buffer;
+
+	while (true) {
+		const auto nbytes = inotify_event.GetFileDescriptor().Read(buffer);
+		if (nbytes <= 0)
+			break;
+
+		const std::byte *p = buffer.data(), *const end = p + nbytes;
+		while (p < end) {
+			const auto &event = *reinterpret_cast<const struct inotify_event *>(p);
+			p += sizeof(event) + event.len;
+
+			if (event.mask & IN_Q_OVERFLOW)
+				/* we lost track; start over */
+				Flush();
+			else
+				Invalidate(event.wd);
+		}
+	}
+}
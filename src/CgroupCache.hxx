@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/PipeEvent.hxx"
+
+#include <cstdint>
+#include <functional> // for std::equal_to
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * A process-wide cache of cgroup information (path, parent chain
+ * and extended attributes), keyed by the cgroup path.
+ *
+ * Each cached cgroup directory is watched with inotify; changing an
+ * extended attribute (IN_ATTRIB) or removing the cgroup invalidates
+ * the entry (and, implicitly, all entries below it).  This means
+ * that a cache hit does not need any filesystem access.  If inotify
+ * is not available, nothing is cached.
+ */
+class CgroupCache {
+public:
+	struct Entry {
+		/**
+		 * The cgroup path as noted in /proc/PID/cgroup.
+		 */
+		std::string path;
+
+		/**
+		 * The extended attributes of the cgroup directory.
+		 */
+		std::map<std::string, std::string, std::less<>> xattr;
+
+		/**
+		 * The parent cgroup or nullptr if this is the root
+		 * cgroup.
+		 */
+		std::shared_ptr<const Entry> parent;
+
+		/**
+		 * Cleared when the cgroup has been modified or
+		 * removed.  Objects which are still referenced by Lua
+		 * code remain usable, but they are not handed out by
+		 * the cache anymore.
+		 */
+		bool valid = true;
+
+		/**
+		 * Are this entry and all of its parents still valid?
+		 */
+		[[gnu::pure]]
+		bool IsValid() const noexcept {
+			for (const Entry *i = this; i != nullptr; i = i->parent.get())
+				if (!i->valid)
+					return false;
+			return true;
+		}
+	};
+
+private:
+	/**
+	 * If the cache grows larger than this, it is flushed.  This
+	 * is just a safeguard; usually, entries are removed when
+	 * their cgroup is removed.
+	 */
+	static constexpr std::size_t MAX_ENTRIES = 4096;
+
+	struct Hash {
+		using is_transparent = void;
+
+		std::size_t operator()(std::string_view s) const noexcept {
+			return std::hash<std::string_view>{}(s);
+		}
+	};
+
+	struct Item {
+		std::shared_ptr<Entry> entry;
+
+		/**
+		 * The inotify watch descriptor.
+		 */
+		int watch;
+	};
+
+	PipeEvent inotify_event;
+
+	std::unordered_map<std::string, Item, Hash, std::equal_to<>> items;
+
+	/**
+	 * Maps inotify watch descriptors to #items keys.
+	 */
+	std::unordered_map<int, std::string> watches;
+
+	uint_least64_t n_hits = 0, n_misses = 0, n_invalidations = 0;
+
+public:
+	explicit CgroupCache(EventLoop &event_loop) noexcept;
+	~CgroupCache() noexcept;
+
+	CgroupCache(const CgroupCache &) = delete;
+	CgroupCache &operator=(const CgroupCache &) = delete;
+
+	/**
+	 * Stop watching and flush the cache; it will not cache
+	 * anything after that.
+	 */
+	void Disable() noexcept;
+
+	/**
+	 * Look up a cgroup, loading it from the cgroup filesystem on
+	 * a cache miss.  Throws on error.
+	 *
+	 * @param path the cgroup path as noted in /proc/PID/cgroup
+	 */
+	std::shared_ptr<const Entry> Get(std::string_view path);
+
+	std::size_t size() const noexcept {
+		return items.size();
+	}
+
+	uint_least64_t GetHits() const noexcept {
+		return n_hits;
+	}
+
+	uint_least64_t GetMisses() const noexcept {
+		return n_misses;
+	}
+
+	uint_least64_t GetInvalidations() const noexcept {
+		return n_invalidations;
+	}
+
+private:
+	std::shared_ptr<const Entry> Lookup(std::string_view path);
+	std::shared_ptr<Entry> Load(std::string_view path);
+
+	void Flush() noexcept;
+	void Invalidate(int watch) noexcept;
+
+	void OnInotifyReady(unsigned events) noexcept;
+};
@@ -10,10 +10,27 @@ ParseCommandLine(int argc, char **argv)
 {
 	CommandLine cmdline;
 
-	if (argc == 3 && StringIsEqual(argv[1], "--config"))
+	constexpr const char *usage =
+		"Usage: cm4all-qrelay [--config PATH] [--handover PATH]\n"
+		"       cm4all-qrelay --bench CONFIG MAILDIR";
+
+	if (argc == 4 && StringIsEqual(argv[1], "--bench")) {
 		cmdline.config_path = argv[2];
-	else if (argc != 1)
-		throw "Usage: cm4all-qrelay [--config PATH]";
+		cmdline.bench_path = argv[3];
+		return cmdline;
+	}
+
+	for (int i = 1; i < argc; i += 2) {
+		if (i + 1 >= argc)
+			throw usage;
+
+		if (StringIsEqual(argv[i], "--config"))
+			cmdline.config_path = argv[i + 1];
+		else if (StringIsEqual(argv[i], "--handover"))
+			cmdline.handover_path = argv[i + 1];
+		else
+			throw usage;
+	}
 
 	return cmdline;
 }
@@ -8,6 +8,20 @@
 
 struct CommandLine {
 	std::string config_path = "/etc/cm4all/qrelay/config.lua";
+
+	/**
+	 * If set, then qrelay runs in benchmark mode: it feeds all
+	 * recorded submissions from this directory through the Lua
+	 * handlers without relaying them.
+	 */
+	std::string bench_path;
+
+	/**
+	 * If set, then listening sockets are taken over from a
+	 * running qrelay process through this local socket, and
+	 * qrelay listens on it for its own successor.
+	 */
+	std::string handover_path;
 };
 
 CommandLine
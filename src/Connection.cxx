@@ -4,20 +4,26 @@
 
 #include "Connection.hxx"
 #include "Instance.hxx"
+#include "ListenerConfig.hxx"
 #include "RemoteRelay.hxx"
 #include "ExecRelay.hxx"
 #include "RawExecRelay.hxx"
+#include "FanoutRelay.hxx"
+#include "SplitRelay.hxx"
 #include "MutableMail.hxx"
 #include "LMail.hxx"
 #include "Action.hxx"
 #include "LAction.hxx"
 #include "net/AllocatedSocketAddress.hxx"
+#include "net/FormatAddress.hxx"
 #include "net/UniqueSocketDescriptor.hxx"
 #include "net/log/Datagram.hxx"
 #include "net/log/Send.hxx"
 #include "lua/PushLambda.hxx"
 #include "lua/Util.hxx"
 #include "lua/Error.hxx"
+#include "lua/StringView.hxx"
+#include "lua/net/SocketAddress.hxx"
 #include "util/ScopeExit.hxx"
 #include "util/SpanCast.hxx"
 
@@ -27,9 +33,36 @@ using std::string_view_literals::operator""sv;
 
 using namespace Lua;
 
+/**
+ * The timeout of secondary relays of a "fanout" action if none was
+ * specified.
+ */
+static constexpr Event::Duration default_fanout_timeout = std::chrono::minutes{1};
+
+/**
+ * @return the address of a TCP client or a null address for local
+ * clients
+ */
+static SocketAddress
+GetRemoteAddress(SocketAddress address) noexcept
+{
+	if (address.IsNull() || address.GetFamily() == AF_LOCAL)
+		return nullptr;
+
+	return address;
+}
+
 static std::string
-MakeLoggerDomain(const SocketPeerAuth &auth, SocketAddress)
+MakeLoggerDomain(const SocketPeerAuth &auth, SocketAddress remote_address)
 {
+	if (!remote_address.IsNull()) {
+		char buffer[256];
+		if (ToString(buffer, remote_address))
+			return buffer;
+
+		return "connection";
+	}
+
 	if (!auth.HaveCred())
 		return "connection";
 
@@ -37,27 +70,48 @@ MakeLoggerDomain(const SocketPeerAuth &auth, SocketAddress)
 }
 
 QmqpRelayConnection::QmqpRelayConnection(Instance &_instance,
-					 size_t max_size,
+					 ListenerConfig &_config,
 					 Lua::ValuePtr _handler,
 					 const RootLogger &parent_logger,
 					 UniqueSocketDescriptor &&_fd,
 					 SocketAddress address)
-	:NetstringServer(_instance.GetEventLoop(), std::move(_fd), max_size),
+	:QmqpServer(_instance.GetEventLoop(), std::move(_fd),
+		    _config.max_size, _config.receive_limits),
 	 instance(_instance),
+	 config(_config),
 	 start_time(_instance.GetEventLoop().SteadyNow()),
 	 peer_auth(GetSocket()),
+	 remote_address(GetRemoteAddress(address)),
 	 handler(std::move(_handler)),
-	 logger(parent_logger, MakeLoggerDomain(peer_auth, address).c_str()),
+	 logger(parent_logger, MakeLoggerDomain(peer_auth, remote_address).c_str()),
 	 auto_close(handler->GetState()),
 	 thread(handler->GetState()),
-	 relay_timeout(_instance.GetEventLoop(), BIND_THIS_METHOD(OnRelayTimeout)) {}
+	 relay_timeout(_instance.GetEventLoop(), BIND_THIS_METHOD(OnRelayTimeout))
+{
+#ifdef HAVE_LIBSODIUM
+	if (config.body_hash)
+		EnableBodyHash();
+#endif
+
+	instance.OnConnectionCreated();
+}
 
 QmqpRelayConnection::~QmqpRelayConnection() noexcept
 {
+	if (destroyed_flag != nullptr) {
+		/* destroyed while OnRequest() or ResumeHandler() was
+		   running */
+		*destroyed_flag = true;
+		CheckSlowCallback(callback_start, callback_name);
+	}
+
 	if (mail_ptr != nullptr)
 		Log("canceled"sv);
 
+	ClearBudget();
 	thread.Cancel();
+
+	instance.OnConnectionDestroyed();
 }
 
 void
@@ -67,43 +121,248 @@ QmqpRelayConnection::Register(lua_State *L)
 	RegisterLuaMail(L);
 }
 
+const char *
+QmqpRelayConnection::ToString(State state) noexcept
+{
+	switch (state) {
+	case State::INIT:
+		return "init";
+
+	case State::RECEIVED:
+		return "received";
+
+	case State::LUA:
+		return "lua";
+
+	case State::NOT_RELAYING:
+		return "not_relaying";
+
+	case State::RELAYING:
+		return "relaying";
+
+	case State::END:
+		return "end";
+	}
+
+	return "?";
+}
+
 void
-QmqpRelayConnection::OnRequest(AllocatedArray<std::byte> &&payload)
+QmqpRelayConnection::CheckSlowCallback(Event::TimePoint start,
+				       const char *what) noexcept
+{
+	const auto duration = Event::Clock::now() - start;
+	if (!instance.GetLoopMonitor().CheckCallback(duration))
+		return;
+
+	const auto msg = fmt::format("slow {}: {} ms in state {}{}{}"sv,
+				     what,
+				     std::chrono::duration_cast<std::chrono::milliseconds>(duration).count(),
+				     ToString(state),
+				     mail_ptr != nullptr ? " from="sv : ""sv,
+				     mail_ptr != nullptr ? mail_ptr->sender : ""sv);
+	logger(2, msg.c_str());
+}
+
+inline void
+QmqpRelayConnection::PushConnectInfo(lua_State *L, std::size_t size)
+{
+	lua_newtable(L);
+
+	Lua::SetField(L, Lua::RelativeStackIndex{-1}, "size",
+		      static_cast<lua_Integer>(size));
+
+	if (!remote_address.IsNull()) {
+		Lua::NewSocketAddress(L, remote_address);
+		lua_setfield(L, -2, "remote_address");
+		return;
+	}
+
+	if (peer_auth.HaveCred()) {
+		Lua::SetField(L, Lua::RelativeStackIndex{-1}, "pid",
+			      static_cast<lua_Integer>(peer_auth.GetPid()));
+		Lua::SetField(L, Lua::RelativeStackIndex{-1}, "uid",
+			      static_cast<lua_Integer>(peer_auth.GetUid()));
+		Lua::SetField(L, Lua::RelativeStackIndex{-1}, "gid",
+			      static_cast<lua_Integer>(peer_auth.GetGid()));
+	}
+
+	/* this call throws if the client process has already
+	   exited */
+	const auto cgroup = peer_auth.GetCgroupPath();
+	if (!cgroup.empty())
+		Lua::SetField(L, Lua::RelativeStackIndex{-1}, "cgroup",
+			      std::string_view{cgroup});
+}
+
+std::string_view
+QmqpRelayConnection::InvokeOnConnect(std::size_t size) noexcept
+try {
+	const auto L = GetMainState();
+
+	/* restore the stack even if PushConnectInfo() throws */
+	const int top = lua_gettop(L);
+	AtScopeExit(L, top) { lua_settop(L, top); };
+
+	config.on_connect->Push(L);
+	PushConnectInfo(L, size);
+
+	/* the hook is called synchronously (not in a coroutine);
+	   it must not yield */
+	if (lua_pcall(L, 1, 1, 0) != 0)
+		throw Lua::PopError(L);
+
+	switch (lua_type(L, -1)) {
+	case LUA_TNIL:
+		return {};
+
+	case LUA_TNUMBER:
+		/* a size limit for this client */
+		if (static_cast<lua_Number>(size) > lua_tonumber(L, -1))
+			return "Dmessage is too large"sv;
+
+		return {};
+
+	case LUA_TSTRING:
+		if (const auto s = Lua::ToStringView(L, -1); s == "reject"sv)
+			return "Drejected"sv;
+		else if (s == "discard"sv)
+			return "Kdiscarded"sv;
+
+		break;
+	}
+
+	throw std::invalid_argument{"Bad return value from on_connect"};
+} catch (...) {
+	logger(1, std::current_exception());
+	return "Zscript failed"sv;
+}
+
+bool
+QmqpRelayConnection::OnHeader(std::size_t size) noexcept
+{
+	if (!config.on_connect)
+		return true;
+
+	early_response = InvokeOnConnect(size);
+	if (early_response.data() == nullptr)
+		return true;
+
+	logger(3, fmt::format("on_connect: {}"sv, early_response.substr(1)).c_str());
+	LogEarly(early_response.substr(1), size);
+	return false;
+}
+
+void
+QmqpRelayConnection::OnSkipped() noexcept
+{
+	assert(state == State::INIT);
+	assert(early_response.data() != nullptr);
+
+	state = State::NOT_RELAYING;
+	Finish(early_response);
+}
+
+inline void
+QmqpRelayConnection::StartRequest(MutableMail &&m)
+{
+	/* this callback runs the Lua handler synchronously; if that takes too long, all other
+	   connections are delayed */
+	callback_start = Event::Clock::now();
+	callback_name = "request";
+
+	bool destroyed = false;
+	destroyed_flag = &destroyed;
+
+	try {
+#ifdef HAVE_LIBSODIUM
+		if (const auto *body_hash = GetBodyHash())
+			m.body_hash = *body_hash;
+#endif
+
+		HandleRequest(std::move(m));
+	} catch (...) {
+		destroyed_flag = nullptr;
+		throw;
+	}
+
+	if (!destroyed) {
+		destroyed_flag = nullptr;
+		CheckSlowCallback(callback_start, callback_name);
+	}
+}
+
+void
+QmqpRelayConnection::OnRequest(AllocatedArray<std::byte> &&payload,
+			       QmqpMail &&mail)
+{
+	StartRequest(MutableMail{std::move(payload), std::move(mail)});
+}
+
+void
+QmqpRelayConnection::OnMemfdRequest(SealedMemfd &&memfd, QmqpMail &&mail)
+{
+	++config.n_memfd_submissions;
+
+	StartRequest(MutableMail{std::move(memfd), std::move(mail)});
+}
+
+void
+QmqpRelayConnection::OnBadRequest(QmqpMail::ParseResult result) noexcept
 {
 	assert(state == State::INIT);
 	state = State::RECEIVED;
 
-	MutableMail mail(std::move(payload));
-	switch (mail.Parse()) {
+	switch (result) {
 	case QmqpMail::ParseResult::SUCCESS:
-		break;
+		/* successful requests are passed to OnRequest() */
+		std::unreachable();
 
 	case QmqpMail::ParseResult::MALFORMED:
 		Finish("Dmalformed input"sv);
-		return;
+		break;
 
 	case QmqpMail::ParseResult::BAD_ADDRESS:
 		Finish("Dbad address"sv);
-		return;
+		break;
 
 	case QmqpMail::ParseResult::TOO_MANY_RECIPIENTS:
 		Finish("Dtoo many recipients"sv);
-		return;
+		break;
 	}
+}
+
+inline void
+QmqpRelayConnection::HandleRequest(MutableMail &&mail)
+{
+	assert(state == State::INIT);
+	state = State::RECEIVED;
 
-	assert(state == State::RECEIVED);
+	/* if the loop has been too busy to collect garbage while
+	   idle, do it now (before the handler starts running) */
+	instance.GetLuaGc().CheckHotPath();
 
 	/* create a new thread for the handler coroutine */
 	const auto L = thread.CreateThread(*this);
 
+	if (config.cpu_budget.count() > 0) {
+		budget.emplace(GetEventLoop(), config.cpu_budget);
+		budget_thread = L;
+		SetLuaBudget(L, *budget);
+	}
+
 	handler->Push(L);
 
 	mail_ptr = NewLuaMail(L, auto_close,
-			      std::move(mail), peer_auth);
+			      std::move(mail), GetPeerAuth(), remote_address,
+			      instance, this);
 	lua_mail = {L, Lua::RelativeStackIndex{-1}};
 
 	state = State::LUA;
 
+	if (budget)
+		budget->StartSlice();
+
 	Resume(L, 1);
 }
 
@@ -152,7 +411,50 @@ QmqpRelayConnection::DoRawExec(const Action &action, const MutableMail &mail)
 }
 
 inline void
-QmqpRelayConnection::Do(const Action &action, const MutableMail &mail)
+QmqpRelayConnection::DoFanout(const Action &action, MutableMail &mail)
+{
+	assert(action.actions.size() >= 2);
+
+	const auto timeout = action.timeout.count() > 0
+		? action.timeout
+		: default_fanout_timeout;
+
+	/* the secondaries run in the background (independent of this
+	   connection); they share the receive buffer with the
+	   primary */
+	const auto headers = AssembleHeaders(mail);
+	for (const auto &i : std::span{action.actions}.subspan(1)) {
+		auto *relay = new FanoutRelay(instance, logger, mail, headers);
+		relay->Start(i, timeout);
+	}
+
+	Do(action.actions.front(), mail);
+}
+
+inline void
+QmqpRelayConnection::DoSplit(const Action &action, const MutableMail &mail)
+{
+	/* the recipient indexes were verified by the Lua method
+	   split(), but the action may have been created by a
+	   different mail (and saved by the handler) */
+	if (action.mail_id != mail.id)
+		throw std::runtime_error{"Split action belongs to a different mail"};
+
+	state = State::RELAYING;
+
+	if (action.timeout.count() > 0)
+		relay_timeout.Schedule(action.timeout);
+
+	auto *relay = new SplitRelay(GetEventLoop(),
+				     instance.GetChildProcessTerminator(),
+				     logger, *this);
+	relay_operation = ToDeletePointer(relay);
+
+	relay->Start(action, mail, AssembleHeaders(mail));
+}
+
+inline void
+QmqpRelayConnection::Do(const Action &action, MutableMail &mail)
 {
 	switch (action.type) {
 	case Action::Type::UNDEFINED:
@@ -183,6 +485,14 @@ QmqpRelayConnection::Do(const Action &action, const MutableMail &mail)
 		state = State::RELAYING;
 		DoRawExec(action, mail);
 		break;
+
+	case Action::Type::FANOUT:
+		DoFanout(action, mail);
+		break;
+
+	case Action::Type::SPLIT:
+		DoSplit(action, mail);
+		break;
 	}
 }
 
@@ -194,7 +504,15 @@ QmqpRelayConnection::AssembleHeaders(const MutableMail &mail) noexcept
 	for (const auto &i : mail.headers)
 		list.emplace_back(std::as_bytes(std::span{i}));
 
-	if (peer_auth.HaveCred()) {
+	if (!remote_address.IsNull()) {
+		char address_buffer[128];
+		if (HostToString(address_buffer, remote_address)) {
+			char *end = fmt::format_to(received_buffer,
+						   "Received: from [{}] with QMQP\r\n",
+						   address_buffer);
+			list.emplace_back(AsBytes(std::string_view{received_buffer, end}));
+		}
+	} else if (peer_auth.HaveCred()) {
 		char *end = fmt::format_to(received_buffer,
 					   "Received: from PID={} UID={} with QMQP\r\n",
 					   peer_auth.GetPid(), peer_auth.GetUid());
@@ -204,6 +522,15 @@ QmqpRelayConnection::AssembleHeaders(const MutableMail &mail) noexcept
 	return list;
 }
 
+void
+QmqpRelayConnection::OnReceiveTimeout(QmqpReceiveTimeout reason) noexcept
+{
+	++config.n_receive_timeouts[static_cast<std::size_t>(reason)];
+
+	logger(2, "receive timeout: ", ToString(reason));
+	delete this;
+}
+
 void
 QmqpRelayConnection::OnError(std::exception_ptr ep) noexcept
 {
@@ -241,12 +568,54 @@ QmqpRelayConnection::OnRelayError(std::string_view response,
 	Finish(response);
 }
 
+inline void
+QmqpRelayConnection::ClearBudget() noexcept
+{
+	if (budget_thread != nullptr) {
+		UnsetLuaBudget(budget_thread);
+		budget_thread = nullptr;
+	}
+}
+
+void
+QmqpRelayConnection::ResumeHandler(lua_State *L, int narg) noexcept
+{
+	assert(destroyed_flag == nullptr);
+
+	/* like StartRequest(), but for the handler slices after the
+	   coroutine has yielded */
+	callback_start = Event::Clock::now();
+	callback_name = "resume";
+
+	bool destroyed = false;
+	destroyed_flag = &destroyed;
+
+	if (budget)
+		budget->StartSlice();
+
+	Lua::Resume(L, narg);
+
+	if (!destroyed) {
+		destroyed_flag = nullptr;
+		CheckSlowCallback(callback_start, callback_name);
+	}
+}
+
 void
 QmqpRelayConnection::OnLuaFinished(lua_State *L) noexcept
 try {
 	assert(state == State::LUA);
 	assert(mail_ptr != nullptr);
 
+	ClearBudget();
+
+	if (budget && budget->exceeded) {
+		/* the handler has caught the budget error with
+		   pcall(); don't obey its action */
+		OnBudgetExceeded();
+		return;
+	}
+
 	const ScopeCheckStack check_thread_stack(L);
 
 	auto *action = CheckLuaAction(L, -1);
@@ -264,10 +633,25 @@ QmqpRelayConnection::OnLuaError(lua_State *, std::exception_ptr &&error) noexcep
 	assert(state == State::LUA);
 	assert(mail_ptr != nullptr);
 
+	ClearBudget();
+
+	if (budget && budget->exceeded) {
+		OnBudgetExceeded();
+		return;
+	}
+
 	logger(1, std::move(error));
 	Finish("Zscript failed"sv);
 }
 
+void
+QmqpRelayConnection::OnBudgetExceeded() noexcept
+{
+	++config.n_budget_exceeded;
+	logger(1, "Lua handler exceeded its CPU budget");
+	Finish("Zscript timeout"sv);
+}
+
 [[gnu::pure]]
 static std::size_t
 TotalSize(const std::forward_list<std::string> &list) noexcept
@@ -299,6 +683,12 @@ QmqpRelayConnection::Log(std::string_view message) noexcept
 		message_buffer += fmt::format("<{}>"sv, i);
 	}
 
+	if (mail_ptr->body_hash) {
+		const auto hex = FormatBodyHash(*mail_ptr->body_hash);
+		message_buffer += " body_hash="sv;
+		message_buffer.append(hex.data(), hex.size());
+	}
+
 	if (!message.empty()) {
 		message_buffer.push_back(' ');
 		message_buffer.append(message);
@@ -307,28 +697,61 @@ QmqpRelayConnection::Log(std::string_view message) noexcept
 	message = message_buffer;
 
 	const std::size_t added_header_size = TotalSize(mail_ptr->headers);
-	const uint_least64_t traffic_received = mail_ptr->buffer.size();
+	const uint_least64_t traffic_received = mail_ptr->GetPayloadSize();
 	const uint_least64_t traffic_sent = state >= State::RELAYING
 		? traffic_received + added_header_size
 		: 0;
 
-	const auto d = Net::Log::Datagram{
-		.timestamp = Net::Log::FromSystem(GetEventLoop().SystemNow()),
+	auto d = Net::Log::Datagram{
 		.site = mail_ptr->account.empty() ? nullptr : mail_ptr->account.c_str(),
 		.message = message,
-		.type = Net::Log::Type::SUBMISSION,
-	}.SetTraffic(traffic_received, traffic_sent)
-		.SetLength(mail_ptr->message.size() + added_header_size)
-		.SetDuration(std::chrono::duration_cast<Net::Log::Duration>(GetEventLoop().SteadyNow() - start_time));
+	};
+	d.SetTraffic(traffic_received, traffic_sent)
+		.SetLength(mail_ptr->message.size() + added_header_size);
+
+	SendLog(d);
+
+	state = State::END;
+	mail_ptr = nullptr;
+}
+
+void
+QmqpRelayConnection::LogEarly(std::string_view message,
+			      std::size_t size) noexcept
+{
+	if (!instance.GetLogSocket().IsDefined())
+		/* logging is disabled */
+		return;
+
+	const std::string message_buffer =
+		fmt::format("on_connect: {} size={}"sv, message, size);
+
+	auto d = Net::Log::Datagram{
+		.message = message_buffer,
+	};
+	d.SetLength(size);
+
+	SendLog(d);
+}
+
+void
+QmqpRelayConnection::SendLog(Net::Log::Datagram &d) noexcept
+{
+	char remote_host[128];
+	if (remote_address.IsNull() ||
+	    !HostToString(remote_host, remote_address))
+		remote_host[0] = 0;
+
+	d.timestamp = Net::Log::FromSystem(GetEventLoop().SystemNow());
+	d.remote_host = remote_host[0] != 0 ? remote_host : nullptr;
+	d.type = Net::Log::Type::SUBMISSION;
+	d.SetDuration(std::chrono::duration_cast<Net::Log::Duration>(GetEventLoop().SteadyNow() - start_time));
 
 	try {
-		Net::Log::Send(log_socket, d);
+		Net::Log::Send(instance.GetLogSocket(), d);
 	} catch (...) {
 		PrintException(std::current_exception());
 	}
-
-	state = State::END;
-	mail_ptr = nullptr;
 }
 
 void
@@ -337,6 +760,13 @@ QmqpRelayConnection::Finish(std::string_view response) noexcept
 	assert(state != State::INIT && state != State::END);
 	assert(!response.empty());
 
+	if (mail_ptr != nullptr && mail_ptr->duplicate_cache != nullptr &&
+	    response.front() == 'K')
+		/* remember this submission so retries can be
+		   suppressed */
+		mail_ptr->duplicate_cache->Insert(mail_ptr->duplicate_key,
+						  GetEventLoop().SteadyNow());
+
 	if (mail_ptr != nullptr)
 		Log(response.substr(1));
 
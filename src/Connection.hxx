@@ -5,36 +5,55 @@
 #pragma once
 
 #include "Handler.hxx"
+#include "LBudget.hxx"
+#include "LMail.hxx"
+#include "QmqpServer.hxx"
 #include "io/Logger.hxx"
-#include "event/net/djb/NetstringServer.hxx"
 #include "lua/AutoCloseList.hxx"
 #include "lua/Ref.hxx"
 #include "lua/Resume.hxx"
 #include "lua/ValuePtr.hxx"
 #include "lua/CoRunner.hxx"
+#include "net/AllocatedSocketAddress.hxx"
 #include "net/linux/PeerAuth.hxx"
 #include "util/DisposablePointer.hxx"
 #include "util/IntrusiveList.hxx"
 
 #include <cstdint>
 #include <list>
+#include <optional>
 
 struct MutableMail;
 struct Action;
+namespace Net::Log { struct Datagram; }
+struct ListenerConfig;
 class Instance;
 
 class QmqpRelayConnection final :
 	public AutoUnlinkIntrusiveListHook,
-	public NetstringServer,
+	public QmqpServer,
 	Lua::ResumeListener,
+	LuaMailResumer,
 	RelayHandler {
 
 	Instance &instance;
 
+	ListenerConfig &config;
+
 	const Event::TimePoint start_time;
 
+	/**
+	 * The credentials of a local client.  Only valid if
+	 * #remote_address is null.
+	 */
 	const SocketPeerAuth peer_auth;
 
+	/**
+	 * The address of a TCP client; null for local clients (which
+	 * are identified by #peer_auth).
+	 */
+	const AllocatedSocketAddress remote_address;
+
 	const Lua::ValuePtr handler;
 	ChildLogger logger;
 
@@ -47,6 +66,18 @@ class QmqpRelayConnection final :
 	 */
 	Lua::CoRunner thread;
 
+	/**
+	 * The coroutine created by #thread (only set while the
+	 * handler runs with a #budget).
+	 */
+	lua_State *budget_thread = nullptr;
+
+	/**
+	 * Limits the CPU time of the Lua handler (only if
+	 * ListenerConfig::cpu_budget is set).
+	 */
+	std::optional<LuaBudget> budget;
+
 	/**
 	 * The #LuaMail that is going to be sent once we've connected to
 	 * the outgoing QMQP server.
@@ -74,6 +105,32 @@ class QmqpRelayConnection final :
 
 	CoarseTimerEvent relay_timeout;
 
+	/**
+	 * The response chosen by the "on_connect" hook; it is sent
+	 * after the payload has been skipped.
+	 */
+	std::string_view early_response;
+
+	/**
+	 * When did the current OnRequest() or ResumeHandler() call
+	 * start?  Used to detect slow callbacks.
+	 */
+	Event::TimePoint callback_start;
+
+	/**
+	 * Which callback is running ("request" or "resume"); only
+	 * used for logging.
+	 */
+	const char *callback_name;
+
+	/**
+	 * Points to a variable on the OnRequest() or
+	 * ResumeHandler() stack frame while it runs; the destructor
+	 * sets it to true, so the method knows it must not access
+	 * this object anymore.
+	 */
+	bool *destroyed_flag = nullptr;
+
 	// only used for logging
 	enum class State : uint_least8_t {
 		/**
@@ -82,8 +139,8 @@ class QmqpRelayConnection final :
 		INIT,
 
 		/**
-		 * A Netstring blob was received and will be parsed
-		 * (and then #mail_ptr will be set).
+		 * The request was received and parsed (and #mail_ptr
+		 * will be set), or it was rejected by the parser.
 		 */
 		RECEIVED,
 
@@ -110,9 +167,12 @@ class QmqpRelayConnection final :
 		END
 	} state = State::INIT;
 
+	[[gnu::const]]
+	static const char *ToString(State state) noexcept;
+
 public:
 	QmqpRelayConnection(Instance &_instance,
-			    size_t max_size, Lua::ValuePtr _handler,
+			    ListenerConfig &_config, Lua::ValuePtr _handler,
 			    const RootLogger &parent_logger,
 			    UniqueSocketDescriptor &&_fd, SocketAddress address);
 	~QmqpRelayConnection() noexcept;
@@ -127,10 +187,27 @@ protected:
 	void DoConnect(const Action &action, const MutableMail &mail);
 	void DoExec(const Action &action, const MutableMail &mail);
 	void DoRawExec(const Action &action, const MutableMail &mail);
-	void Do(const Action &action, const MutableMail &mail);
+	void DoFanout(const Action &action, MutableMail &mail);
+	void DoSplit(const Action &action, const MutableMail &mail);
+	void Do(const Action &action, MutableMail &mail);
 	void OnResponse(const void *data, size_t size);
 
-	void OnRequest(AllocatedArray<std::byte> &&payload) override;
+	void HandleRequest(MutableMail &&mail);
+
+	/**
+	 * Common code for OnRequest() and OnMemfdRequest().
+	 */
+	void StartRequest(MutableMail &&mail);
+
+	/* virtual methods from class QmqpServer */
+	bool OnHeader(std::size_t size) noexcept override;
+	void OnSkipped() noexcept override;
+	void OnRequest(AllocatedArray<std::byte> &&payload,
+		       QmqpMail &&mail) override;
+	void OnMemfdRequest(SealedMemfd &&memfd,
+			    QmqpMail &&mail) override;
+	void OnBadRequest(QmqpMail::ParseResult result) noexcept override;
+	void OnReceiveTimeout(QmqpReceiveTimeout reason) noexcept override;
 	void OnError(std::exception_ptr ep) noexcept override;
 	void OnDisconnect() noexcept override;
 
@@ -139,6 +216,14 @@ private:
 		return thread.GetMainState();
 	}
 
+	/**
+	 * @return the credentials of a local client or nullptr for
+	 * TCP clients
+	 */
+	const SocketPeerAuth *GetPeerAuth() const noexcept {
+		return remote_address.IsNull() ? &peer_auth : nullptr;
+	}
+
 	/**
 	 * Assemble all headers generated by this process.
 	 */
@@ -146,6 +231,51 @@ private:
 
 	void Log(std::string_view message) noexcept;
 
+	/**
+	 * Log a decision of the "on_connect" hook (i.e. one made
+	 * before the mail was received).
+	 *
+	 * @param size the announced payload size
+	 */
+	void LogEarly(std::string_view message, std::size_t size) noexcept;
+
+	/**
+	 * Fill in the fields common to all log datagrams of this
+	 * connection and send it to the log socket.
+	 */
+	void SendLog(Net::Log::Datagram &d) noexcept;
+
+	/**
+	 * Push the "info" table for the "on_connect" hook.
+	 */
+	void PushConnectInfo(lua_State *L, std::size_t size);
+
+	/**
+	 * Invoke the "on_connect" hook.
+	 *
+	 * @return the response to be sent without receiving the
+	 * payload or a null string_view to receive the request
+	 */
+	std::string_view InvokeOnConnect(std::size_t size) noexcept;
+
+	/**
+	 * Stop enforcing the #budget (if any).
+	 */
+	void ClearBudget() noexcept;
+
+	/**
+	 * The handler has exceeded the #budget; reject the mail with
+	 * a temporary error.
+	 */
+	void OnBudgetExceeded() noexcept;
+
+	/**
+	 * Check how long the current callback has been running
+	 * (since @p start) and log a warning if it was too slow.
+	 */
+	void CheckSlowCallback(Event::TimePoint start,
+			       const char *what) noexcept;
+
 	void OnRelayTimeout() noexcept;
 
 	/**
@@ -158,6 +288,9 @@ private:
 	void OnRelayError(std::string_view response,
 			  std::exception_ptr error) noexcept override;
 
+	/* virtual methods from class LuaMailResumer */
+	void ResumeHandler(lua_State *L, int narg) noexcept override;
+
 	/* virtual methods from class Lua::ResumeListener */
 	void OnLuaFinished(lua_State *L) noexcept override;
 	void OnLuaError(lua_State *L, std::exception_ptr &&error) noexcept override;
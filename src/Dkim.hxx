@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "HeaderIndex.hxx"
+
+#include <sodium/crypto_sign_ed25519.h>
+
+#include <openssl/types.h>
+
+#include <array>
+#include <ctime>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+/*
+ * DKIM signatures (RFC 6376) with the algorithms "rsa-sha256" and
+ * "ed25519-sha256" (RFC 8463) and "relaxed/relaxed" canonicalization.
+ */
+
+using DkimSecretKey = std::array<unsigned char, crypto_sign_ed25519_SECRETKEYBYTES>;
+
+struct DkimRsaKeyDeleter {
+	void operator()(EVP_PKEY *key) const noexcept;
+};
+
+using DkimRsaKey = std::unique_ptr<EVP_PKEY, DkimRsaKeyDeleter>;
+
+/**
+ * A signing domain with its private key.
+ */
+struct DkimKey {
+	std::string domain, selector;
+
+	/**
+	 * The RSA key; if this is nullptr, then #secret_key is an
+	 * Ed25519 key.
+	 */
+	DkimRsaKey rsa_key;
+
+	DkimSecretKey secret_key;
+
+	DkimKey() = default;
+	DkimKey(const DkimKey &) = delete;
+	DkimKey &operator=(const DkimKey &) = delete;
+
+	~DkimKey() noexcept;
+};
+
+/**
+ * Parse an Ed25519 private key.  Accepted formats are PKCS#8 PEM (as
+ * generated by "openssl genpkey -algorithm ed25519") and the
+ * base64-encoded 32 byte seed.  Throws on error.
+ */
+DkimSecretKey
+ParseDkimPrivateKey(std::string_view s);
+
+/**
+ * Parse a PEM private key if it is an RSA key (PKCS#1 or PKCS#8, as
+ * generated by "openssl genrsa").  Keys shorter than 1024 bits are
+ * rejected (RFC 8301 3.2).
+ *
+ * Throws on error.
+ *
+ * @return the key or nullptr if this is not an RSA key
+ */
+DkimRsaKey
+ParseDkimRsaPrivateKey(std::string_view s);
+
+/**
+ * Load the private key (RSA or Ed25519) from a file.  Throws on
+ * error.
+ */
+void
+LoadDkimKey(DkimKey &key, std::string_view domain, std::string_view selector,
+	    const char *path);
+
+/**
+ * Find the body of a message, i.e. everything after the first empty
+ * line.
+ *
+ * @return the body (empty if there is no empty line)
+ */
+[[gnu::pure]]
+std::string_view
+FindMessageBody(std::string_view message) noexcept;
+
+/**
+ * Append the "relaxed" canonical form of a header field (RFC 6376
+ * 3.4.2) without the trailing CRLF.
+ */
+void
+DkimCanonicalizeHeader(std::string &dest,
+		       std::string_view name, std::string_view value) noexcept;
+
+/**
+ * Calculate the base64-encoded SHA-256 hash of the "relaxed"
+ * canonical form of a message body (RFC 6376 3.4.4).  Line endings
+ * may be LF or CRLF.
+ */
+std::string
+DkimBodyHash(std::string_view body) noexcept;
+
+/**
+ * Sign a message.  Throws on error.
+ *
+ * @param fields all header fields of the message in the order they
+ * will be transmitted
+ * @param signed_names the names of the header fields to be signed
+ * (the "h=" tag); must include "From"
+ * @param body the message body
+ * @return the value of the "DKIM-Signature" header field
+ */
+std::string
+DkimSign(const DkimKey &key,
+	 std::span<const HeaderIndex::Field> fields,
+	 std::span<const std::string_view> signed_names,
+	 std::string_view body, std::time_t timestamp);
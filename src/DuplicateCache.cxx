@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "DuplicateCache.hxx"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+static std::size_t
+CalcBucketMask(std::size_t capacity, std::size_t ways) noexcept
+{
+	const std::size_t n_buckets = std::bit_ceil(std::max<std::size_t>((capacity + ways - 1) / ways, 1));
+	return n_buckets - 1;
+}
+
+DuplicateCache::DuplicateCache(std::string_view _name, std::size_t capacity,
+			       Event::Duration _ttl) noexcept
+	:name(_name), ttl(_ttl),
+	 bucket_mask(CalcBucketMask(capacity, WAYS)),
+	 entries(new Entry[(bucket_mask + 1) * WAYS]{})
+{
+}
+
+inline DuplicateCache::Entry *
+DuplicateCache::GetBucket(const Key &key) const noexcept
+{
+	/* the key is a cryptographic hash; any part of it is good
+	   enough as a bucket index */
+	std::size_t h;
+	std::memcpy(&h, key.data(), sizeof(h));
+
+	return &entries[(h & bucket_mask) * WAYS];
+}
+
+bool
+DuplicateCache::Contains(const Key &key, Event::TimePoint now) noexcept
+{
+	++n_lookups;
+
+	const auto *bucket = GetBucket(key);
+	for (std::size_t i = 0; i < WAYS; ++i) {
+		if (bucket[i].key == key && bucket[i].expires > now) {
+			++n_hits;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void
+DuplicateCache::Insert(const Key &key, Event::TimePoint now) noexcept
+{
+	auto *bucket = GetBucket(key);
+
+	/* find the existing entry or the one closest to its expiry
+	   (which may be empty or expired already) */
+	Entry *victim = bucket;
+	for (std::size_t i = 0; i < WAYS; ++i) {
+		if (bucket[i].key == key) {
+			victim = &bucket[i];
+			break;
+		}
+
+		if (bucket[i].expires < victim->expires)
+			victim = &bucket[i];
+	}
+
+	if (victim->key != key && victim->expires > now)
+		++n_evictions;
+
+	victim->key = key;
+	victim->expires = now + ttl;
+}
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "BodyHash.hxx"
+#include "event/Chrono.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * A fixed-size cache of recently relayed submissions, used to
+ * suppress duplicates.  The keys are already uniformly distributed
+ * hashes of the mail (see HashEnvelope()).
+ *
+ * It is a set-associative table: each key maps to one bucket of
+ * #WAYS entries, and when a bucket is full, the entry closest to
+ * its expiry is replaced.  All memory is allocated by the
+ * constructor; lookups and insertions do not allocate and cost
+ * O(1).
+ */
+class DuplicateCache {
+public:
+	using Key = BodyHash;
+
+private:
+	static constexpr std::size_t WAYS = 4;
+
+	struct Entry {
+		Key key;
+
+		/**
+		 * The entry is valid until this time.  A
+		 * default-initialized (i.e. ancient) value marks an
+		 * empty entry.
+		 */
+		Event::TimePoint expires;
+	};
+
+	const std::string name;
+
+	const Event::Duration ttl;
+
+	/**
+	 * The number of buckets minus one (the number of buckets is
+	 * a power of two).
+	 */
+	const std::size_t bucket_mask;
+
+	const std::unique_ptr<Entry[]> entries;
+
+	uint_least64_t n_lookups = 0, n_hits = 0, n_evictions = 0;
+
+public:
+	/**
+	 * @param capacity the maximum number of entries (rounded up
+	 * to a multiple of #WAYS and a power of two)
+	 * @param _ttl how long a submission is remembered
+	 */
+	DuplicateCache(std::string_view _name, std::size_t capacity,
+		       Event::Duration _ttl) noexcept;
+
+	DuplicateCache(const DuplicateCache &) = delete;
+	DuplicateCache &operator=(const DuplicateCache &) = delete;
+
+	const std::string &GetName() const noexcept {
+		return name;
+	}
+
+	std::size_t GetCapacity() const noexcept {
+		return (bucket_mask + 1) * WAYS;
+	}
+
+	/**
+	 * The amount of memory allocated for the table.
+	 */
+	std::size_t GetMemorySize() const noexcept {
+		return GetCapacity() * sizeof(Entry);
+	}
+
+	uint_least64_t GetLookups() const noexcept {
+		return n_lookups;
+	}
+
+	uint_least64_t GetHits() const noexcept {
+		return n_hits;
+	}
+
+	/**
+	 * The number of entries which were replaced before they
+	 * expired because their bucket was full.
+	 */
+	uint_least64_t GetEvictions() const noexcept {
+		return n_evictions;
+	}
+
+	/**
+	 * Was a submission with this key remembered, and has it not
+	 * yet expired?
+	 */
+	bool Contains(const Key &key, Event::TimePoint now) noexcept;
+
+	/**
+	 * Remember a submission with this key (or refresh the
+	 * existing entry).
+	 */
+	void Insert(const Key &key, Event::TimePoint now) noexcept;
+
+private:
+	[[gnu::pure]]
+	Entry *GetBucket(const Key &key) const noexcept;
+};
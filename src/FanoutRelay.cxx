@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "FanoutRelay.hxx"
+#include "Action.hxx"
+#include "Instance.hxx"
+#include "MutableMail.hxx"
+#include "RemoteRelay.hxx"
+#include "ExecRelay.hxx"
+#include "RawExecRelay.hxx"
+#include "util/SpanCast.hxx"
+
+#include <fmt/format.h>
+
+#include <cassert>
+
+using std::string_view_literals::operator""sv;
+
+const char *
+ToString(FanoutResult result) noexcept
+{
+	switch (result) {
+	case FanoutResult::ACCEPTED:
+		return "accepted";
+
+	case FanoutResult::REJECTED:
+		return "rejected";
+
+	case FanoutResult::FAILED:
+		return "failed";
+
+	case FanoutResult::TIMEOUT:
+		return "timeout";
+	}
+
+	return "?";
+}
+
+FanoutRelay::FanoutRelay(Instance &_instance, const LoggerBase &parent_logger,
+			 MutableMail &_mail,
+			 const std::list<std::span<const std::byte>> &_headers)
+	:instance(_instance),
+	 logger(parent_logger, "fanout"),
+	 buffer(_mail.ShareBuffer()),
+	 sender(_mail.sender),
+	 mail(_mail),
+	 timeout(instance.GetEventLoop(), BIND_THIS_METHOD(OnTimeout))
+{
+	mail.sender = sender;
+
+	auto i = headers.before_begin();
+	for (const auto &h : _headers)
+		i = headers.emplace_after(i, ToStringView(h));
+
+	/* register only after everything which may throw */
+	instance.OnFanoutRelayCreated(*this);
+}
+
+FanoutRelay::~FanoutRelay() noexcept
+{
+	/* unlink now (and not in the base class destructor) so
+	   OnFanoutRelayDestroyed() doesn't see us anymore */
+	unlink();
+	instance.OnFanoutRelayDestroyed();
+}
+
+void
+FanoutRelay::Start(const Action &action,
+		   Event::Duration default_timeout) noexcept
+try {
+	timeout.Schedule(action.timeout.count() > 0
+			 ? action.timeout
+			 : default_timeout);
+
+	std::list<std::span<const std::byte>> request_headers;
+	for (const auto &i : headers)
+		request_headers.emplace_back(AsBytes(i));
+
+	/* the relay's Start() method may invoke our RelayHandler
+	   methods (which delete this object), so don't touch any
+	   field after calling it */
+
+	switch (action.type) {
+	case Action::Type::CONNECT:
+		{
+			auto *relay = new RemoteRelay(instance.GetEventLoop(),
+						      mail, std::move(request_headers),
+						      *this);
+			relay_operation = ToDeletePointer(relay);
+			relay->Start(action.connect);
+		}
+		break;
+
+	case Action::Type::EXEC:
+		{
+			auto *relay = new ExecRelay(instance.GetEventLoop(),
+						    instance.GetChildProcessTerminator(),
+						    mail, std::move(request_headers),
+						    *this);
+			relay_operation = ToDeletePointer(relay);
+			relay->Start(action);
+		}
+		break;
+
+	case Action::Type::EXEC_RAW:
+		{
+			auto *relay = new RawExecRelay(instance.GetEventLoop(),
+						       instance.GetChildProcessTerminator(),
+						       mail, std::move(request_headers),
+						       *this);
+			relay_operation = ToDeletePointer(relay);
+			relay->Start(action);
+		}
+		break;
+
+	case Action::Type::UNDEFINED:
+	case Action::Type::DISCARD:
+	case Action::Type::REJECT:
+	case Action::Type::FANOUT:
+	case Action::Type::SPLIT:
+		/* rejected by the Lua method fanout() */
+		assert(false);
+		std::unreachable();
+	}
+} catch (...) {
+	logger(1, std::current_exception());
+	Finish(FanoutResult::FAILED, "Zinternal server error"sv);
+}
+
+void
+FanoutRelay::Finish(FanoutResult result, std::string_view response) noexcept
+{
+	instance.OnFanoutRelayFinished(result);
+
+	logger(result == FanoutResult::ACCEPTED ? 4 : 2,
+	       fmt::format("{}: {}"sv, ToString(result), response).c_str());
+
+	delete this;
+}
+
+void
+FanoutRelay::OnTimeout() noexcept
+{
+	Finish(FanoutResult::TIMEOUT, "Ztimeout"sv);
+}
+
+void
+FanoutRelay::OnRelayResponse(std::string_view response) noexcept
+{
+	FanoutResult result;
+	switch (response.front()) {
+	case 'K':
+		result = FanoutResult::ACCEPTED;
+		break;
+
+	case 'D':
+		result = FanoutResult::REJECTED;
+		break;
+
+	default:
+		result = FanoutResult::FAILED;
+		break;
+	}
+
+	Finish(result, response);
+}
+
+void
+FanoutRelay::OnRelayError(std::string_view response,
+			  std::exception_ptr error) noexcept
+{
+	logger(1, error);
+	Finish(FanoutResult::FAILED, response);
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "Handler.hxx"
+#include "djb/QmqpMail.hxx"
+#include "io/Logger.hxx"
+#include "event/CoarseTimerEvent.hxx"
+#include "util/DisposablePointer.hxx"
+#include "util/IntrusiveList.hxx"
+
+#include <cstddef>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <span>
+#include <string>
+
+struct Action;
+struct MailBuffer;
+struct MutableMail;
+class Instance;
+
+enum class FanoutResult {
+	/**
+	 * The destination has accepted the mail ("K").
+	 */
+	ACCEPTED,
+
+	/**
+	 * The destination has rejected the mail permanently ("D").
+	 */
+	REJECTED,
+
+	/**
+	 * A temporary failure ("Z"), e.g. the destination was not
+	 * reachable.
+	 */
+	FAILED,
+
+	/**
+	 * The destination has not responded in time.
+	 */
+	TIMEOUT,
+};
+
+static constexpr std::size_t N_FANOUT_RESULTS = 4;
+
+const char *
+ToString(FanoutResult result) noexcept;
+
+/**
+ * Relays a copy of a mail to a secondary destination of a
+ * "fanout" action.  It runs in the background, independent of the
+ * #QmqpRelayConnection which created it (which may be gone long
+ * before this object); the outcome is only logged.  The object
+ * deletes itself when done.
+ */
+class FanoutRelay final : public AutoUnlinkIntrusiveListHook, RelayHandler {
+	Instance &instance;
+
+	const ChildLogger logger;
+
+	/**
+	 * Owns the memory #mail points into.
+	 */
+	const std::shared_ptr<const MailBuffer> buffer;
+
+	/**
+	 * Copies of the envelope sender and the additional headers
+	 * because the #MutableMail may be freed before we're done.
+	 */
+	const std::string sender;
+	std::forward_list<std::string> headers;
+
+	QmqpMail mail;
+
+	DisposablePointer relay_operation;
+
+	CoarseTimerEvent timeout;
+
+public:
+	/**
+	 * Throws std::bad_alloc.
+	 *
+	 * @param _headers the additional headers (see
+	 * QmqpRelayConnection::AssembleHeaders()); they are copied
+	 */
+	FanoutRelay(Instance &_instance, const LoggerBase &parent_logger,
+		    MutableMail &_mail,
+		    const std::list<std::span<const std::byte>> &_headers);
+
+	~FanoutRelay() noexcept;
+
+	FanoutRelay(const FanoutRelay &) = delete;
+	FanoutRelay &operator=(const FanoutRelay &) = delete;
+
+	/**
+	 * Start relaying.  This object may be destroyed before this
+	 * method returns.
+	 *
+	 * @param action a #CONNECT, #EXEC or #EXEC_RAW action
+	 * @param default_timeout the timeout to be used if the
+	 * action does not specify one
+	 */
+	void Start(const Action &action, Event::Duration default_timeout) noexcept;
+
+	/**
+	 * Abort relaying (e.g. on shutdown).  The result is counted
+	 * and logged as #TIMEOUT, and this object is destroyed.
+	 */
+	void Cancel() noexcept {
+		Finish(FanoutResult::TIMEOUT, "Zcanceled");
+	}
+
+private:
+	void Finish(FanoutResult result, std::string_view response) noexcept;
+
+	void OnTimeout() noexcept;
+
+	/* virtual methods from class RelayHandler */
+	void OnRelayResponse(std::string_view response) noexcept override;
+	void OnRelayError(std::string_view response,
+			  std::exception_ptr error) noexcept override;
+};
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "Handover.hxx"
+#include "lib/fmt/RuntimeError.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "net/AllocatedSocketAddress.hxx"
+#include "net/LocalSocketAddress.hxx"
+#include "net/SocketConfig.hxx"
+
+#include <array>
+#include <span>
+#include <stdexcept>
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * The maximum number of file descriptors in one SCM_RIGHTS message
+ * (SCM_MAX_FD in the kernel).
+ */
+static constexpr std::size_t MAX_HANDOVER_FDS = 253;
+
+static constexpr char COMMIT_BYTE = 'R';
+
+static UniqueSocketDescriptor
+CreateHandoverSocket(const char *path)
+{
+	/* the previous process has already closed its socket, but
+	   it did not delete the file (because we might have bound
+	   our own one by then) */
+	unlink(path);
+
+	const SocketConfig config{
+		.bind_address = AllocatedSocketAddress{LocalSocketAddress{path}},
+		.listen = 4,
+		.mode = 0600,
+	};
+
+	return config.Create(SOCK_SEQPACKET);
+}
+
+HandoverServer::HandoverServer(EventLoop &event_loop, const char *path,
+			       HandoverHandler &_handler)
+	:fd(CreateHandoverSocket(path)),
+	 event(event_loop, BIND_THIS_METHOD(OnSocketReady), fd),
+	 peer_event(event_loop, BIND_THIS_METHOD(OnPeerReady)),
+	 handler(_handler)
+{
+	event.ScheduleRead();
+}
+
+HandoverServer::~HandoverServer() noexcept
+{
+	event.Cancel();
+	peer_event.Close();
+}
+
+static void
+SendHandover(SocketDescriptor s, std::span<const SocketDescriptor> fds)
+{
+	if (fds.size() > MAX_HANDOVER_FDS)
+		throw std::runtime_error("Too many sockets for handover");
+
+	static constexpr char payload = 'H';
+	struct iovec iov{
+		.iov_base = const_cast<char *>(&payload),
+		.iov_len = sizeof(payload),
+	};
+
+	alignas(struct cmsghdr) std::array<std::byte, CMSG_SPACE(MAX_HANDOVER_FDS * sizeof(int))> control;
+
+	struct msghdr msg{
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+	};
+
+	if (!fds.empty()) {
+		msg.msg_control = control.data();
+		msg.msg_controllen = CMSG_SPACE(fds.size() * sizeof(int));
+
+		struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_RIGHTS;
+		cmsg->cmsg_len = CMSG_LEN(fds.size() * sizeof(int));
+
+		int *dest = reinterpret_cast<int *>(CMSG_DATA(cmsg));
+		for (const auto &i : fds)
+			*dest++ = i.Get();
+	}
+
+	if (sendmsg(s.Get(), &msg, MSG_NOSIGNAL) < 0)
+		throw FmtErrno("Failed to send {} sockets", fds.size());
+}
+
+void
+HandoverServer::OnSocketReady(unsigned) noexcept
+{
+	UniqueSocketDescriptor new_peer{AdoptTag{},
+		accept4(fd.Get(), nullptr, nullptr, SOCK_CLOEXEC)};
+	if (!new_peer.IsDefined())
+		return;
+
+	if (peer_event.IsDefined())
+		/* another handover is already in progress */
+		return;
+
+	struct ucred cred;
+	socklen_t cred_size = sizeof(cred);
+	if (getsockopt(new_peer.Get(), SOL_SOCKET, SO_PEERCRED,
+		       &cred, &cred_size) < 0 ||
+	    (cred.uid != geteuid() && cred.uid != 0))
+		/* not our successor */
+		return;
+
+	try {
+		SendHandover(new_peer, handler.GetHandoverSockets());
+	} catch (...) {
+		handler.OnHandoverError(std::current_exception());
+		return;
+	}
+
+	peer_event.Open(new_peer.Release());
+	peer_event.ScheduleRead();
+}
+
+void
+HandoverServer::OnPeerReady(unsigned) noexcept
+{
+	char value;
+	const auto nbytes = recv(peer_event.GetSocket().Get(),
+				 &value, sizeof(value), MSG_DONTWAIT);
+	if (nbytes < 0 && errno == EAGAIN)
+		return;
+
+	peer_event.Close();
+
+	if (nbytes == 1 && value == COMMIT_BYTE)
+		handler.OnHandoverCommit();
+	else
+		handler.OnHandoverError(std::make_exception_ptr(std::runtime_error("Successor has disconnected before it was ready")));
+}
+
+std::forward_list<UniqueSocketDescriptor>
+HandoverClient::Receive(const char *path)
+{
+	std::forward_list<UniqueSocketDescriptor> result;
+
+	s = UniqueSocketDescriptor{AdoptTag{},
+		socket(AF_LOCAL, SOCK_SEQPACKET|SOCK_CLOEXEC, 0)};
+	if (!s.IsDefined())
+		throw FmtErrno("Failed to create socket");
+
+	const LocalSocketAddress address{path};
+	if (connect(s.Get(), address.GetAddress(), address.GetSize()) < 0) {
+		s.Close();
+
+		if (errno == ENOENT || errno == ECONNREFUSED)
+			/* no predecessor running */
+			return result;
+
+		throw FmtErrno("Failed to connect to {}", path);
+	}
+
+	/* don't wait forever if the predecessor hangs */
+	static constexpr struct timeval timeout{.tv_sec = 10};
+	setsockopt(s.Get(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	char payload;
+	struct iovec iov{
+		.iov_base = &payload,
+		.iov_len = sizeof(payload),
+	};
+
+	alignas(struct cmsghdr) std::array<std::byte, CMSG_SPACE(MAX_HANDOVER_FDS * sizeof(int))> control;
+
+	struct msghdr msg{
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+		.msg_control = control.data(),
+		.msg_controllen = control.size(),
+	};
+
+	const auto nbytes = recvmsg(s.Get(), &msg, MSG_CMSG_CLOEXEC);
+	if (nbytes < 0)
+		throw FmtErrno("Failed to receive sockets from {}", path);
+
+	if (nbytes == 0) {
+		/* the predecessor has refused the handover (another
+		   one is in progress) */
+		s.Close();
+		throw FmtRuntimeError("Handover refused by {}", path);
+	}
+
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+	     cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET ||
+		    cmsg->cmsg_type != SCM_RIGHTS)
+			continue;
+
+		const std::size_t n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+		const int *src = reinterpret_cast<const int *>(CMSG_DATA(cmsg));
+		for (std::size_t i = 0; i < n; ++i)
+			result.emplace_front(AdoptTag{}, src[i]);
+	}
+
+	if (msg.msg_flags & MSG_CTRUNC)
+		throw std::runtime_error("Too many sockets in handover");
+
+	return result;
+}
+
+void
+HandoverClient::Commit()
+{
+	if (!s.IsDefined())
+		return;
+
+	if (send(s.Get(), &COMMIT_BYTE, sizeof(COMMIT_BYTE), MSG_NOSIGNAL) < 0)
+		throw FmtErrno("Failed to commit the handover");
+
+	s.Close();
+}
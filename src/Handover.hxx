@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/SocketEvent.hxx"
+#include "net/UniqueSocketDescriptor.hxx"
+
+#include <exception>
+#include <forward_list>
+#include <vector>
+
+/*
+ * Passing listening sockets from a running qrelay process to its
+ * successor (over a local SOCK_SEQPACKET socket with SCM_RIGHTS),
+ * so the sockets are never absent during a restart.
+ *
+ * The protocol: the successor connects and receives one message
+ * with all sockets; both processes now accept connections on them.
+ * Once the successor has finished loading its configuration, it
+ * sends one byte ('R'); the predecessor then stops accepting and
+ * exits after its in-flight submissions are done.  If the successor
+ * disconnects without sending this byte (e.g. because it failed to
+ * start), the predecessor just carries on.
+ */
+
+class HandoverHandler {
+public:
+	/**
+	 * Collect the listening sockets to be passed to a
+	 * successor.
+	 */
+	virtual std::vector<SocketDescriptor> GetHandoverSockets() const noexcept = 0;
+
+	/**
+	 * The successor is ready; stop accepting connections.
+	 */
+	virtual void OnHandoverCommit() noexcept = 0;
+
+	virtual void OnHandoverError(std::exception_ptr error) noexcept = 0;
+};
+
+/**
+ * Listens on a local socket for a new qrelay process which wants to
+ * take over our listening sockets.  Only peers running as the same
+ * user (or root) are accepted, and only one at a time.
+ */
+class HandoverServer {
+	UniqueSocketDescriptor fd;
+	SocketEvent event;
+
+	/**
+	 * The connection to the successor which has received our
+	 * sockets and which we are waiting for to become ready.
+	 */
+	SocketEvent peer_event;
+
+	HandoverHandler &handler;
+
+public:
+	/**
+	 * Throws on error.
+	 */
+	HandoverServer(EventLoop &event_loop, const char *path,
+		       HandoverHandler &_handler);
+	~HandoverServer() noexcept;
+
+	HandoverServer(const HandoverServer &) = delete;
+	HandoverServer &operator=(const HandoverServer &) = delete;
+
+private:
+	void OnSocketReady(unsigned events) noexcept;
+	void OnPeerReady(unsigned events) noexcept;
+};
+
+/**
+ * The successor's side of the handover.
+ */
+class HandoverClient {
+	UniqueSocketDescriptor s;
+
+public:
+	/**
+	 * Connect to the #HandoverServer of a running qrelay process
+	 * and receive its listening sockets.  Throws on error.
+	 *
+	 * @return the sockets (empty if no process is listening on
+	 * @p path)
+	 */
+	std::forward_list<UniqueSocketDescriptor> Receive(const char *path);
+
+	/**
+	 * Tell the predecessor that this process is ready; it will
+	 * stop accepting connections and exit after its in-flight
+	 * submissions are done.  Throws on error.
+	 */
+	void Commit();
+};
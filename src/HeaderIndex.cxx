@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "HeaderIndex.hxx"
+#include "util/CharRange.hxx"
+#include "util/CharUtil.hxx"
+
+#include <algorithm>
+
+static constexpr bool
+IsWhitespace(char ch) noexcept
+{
+	return ch == ' ' || ch == '\t';
+}
+
+/**
+ * Split the first line from @p input.
+ *
+ * @return the line without the line break (LF or CRLF)
+ */
+static std::string_view
+NextLine(std::string_view &input) noexcept
+{
+	std::string_view line;
+
+	if (const auto lf = input.find('\n'); lf != input.npos) {
+		line = input.substr(0, lf);
+		input.remove_prefix(lf + 1);
+	} else {
+		line = input;
+		input = {};
+	}
+
+	if (line.ends_with('\r'))
+		line.remove_suffix(1);
+
+	return line;
+}
+
+HeaderIndex::HeaderIndex(std::string_view message) noexcept
+{
+	while (!message.empty()) {
+		const auto line = NextLine(message);
+		if (line.empty())
+			/* end of the header block */
+			break;
+
+		if (IsWhitespace(line.front())) {
+			/* a continuation line: extend the previous
+			   field's value up to the end of this line
+			   (both point into the same buffer) */
+			if (fields.empty())
+				break;
+
+			auto &value = fields.back().value;
+			value = {value.data(), static_cast<std::size_t>(line.data() + line.size() - value.data())};
+			continue;
+		}
+
+		const auto colon = line.find(':');
+		if (colon == line.npos || colon == 0)
+			break;
+
+		const auto name = line.substr(0, colon);
+		if (!CheckCharRange(name, 33, 126))
+			break;
+
+		auto value = line.substr(colon + 1);
+		while (!value.empty() && IsWhitespace(value.front()))
+			value.remove_prefix(1);
+
+		fields.push_back({name, value});
+	}
+}
+
+bool
+IsSameHeaderName(std::string_view a, std::string_view b) noexcept
+{
+	return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+			  [](char x, char y){
+				  return ToLowerASCII(x) == ToLowerASCII(y);
+			  });
+}
+
+bool
+HeaderIndex::IsName(const Field &field, std::string_view name) noexcept
+{
+	return IsSameHeaderName(field.name, name);
+}
+
+const HeaderIndex::Field *
+HeaderIndex::Find(std::string_view name) const noexcept
+{
+	for (const auto &i : fields)
+		if (IsName(i, name))
+			return &i;
+
+	return nullptr;
+}
+
+std::string
+UnfoldHeaderValue(std::string_view value)
+{
+	std::string result;
+	result.reserve(value.size());
+
+	while (!value.empty()) {
+		auto line = NextLine(value);
+		result.append(line);
+	}
+
+	return result;
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Compare two header field names (case-insensitive, RFC 5322 1.2.2).
+ */
+[[gnu::pure]]
+bool
+IsSameHeaderName(std::string_view a, std::string_view b) noexcept;
+
+/**
+ * An index of the header block (RFC 5322 2.2) of a message.  It does
+ * not copy anything: names and values point into the message
+ * buffer, and values are unfolded only on demand.
+ */
+class HeaderIndex {
+public:
+	struct Field {
+		std::string_view name;
+
+		/**
+		 * The value without leading whitespace and without
+		 * the trailing line break; it may still contain
+		 * folding line breaks.
+		 */
+		std::string_view value;
+	};
+
+private:
+	std::vector<Field> fields;
+
+public:
+	/**
+	 * Parse the header block at the beginning of @p message.
+	 * Parsing stops at the first empty line or at the first line
+	 * which is neither a header field nor a continuation line.
+	 */
+	explicit HeaderIndex(std::string_view message) noexcept;
+
+	std::span<const Field> GetFields() const noexcept {
+		return fields;
+	}
+
+	/**
+	 * Find the first field with the specified name
+	 * (case-insensitive).
+	 *
+	 * @return the field or nullptr if there is none
+	 */
+	[[gnu::pure]]
+	const Field *Find(std::string_view name) const noexcept;
+
+	/**
+	 * Invoke the function for each field with the specified name
+	 * (case-insensitive), in order of appearance.
+	 */
+	void ForEach(std::string_view name, auto &&f) const {
+		for (const auto &i : fields)
+			if (IsName(i, name))
+				f(i);
+	}
+
+private:
+	[[gnu::pure]]
+	static bool IsName(const Field &field, std::string_view name) noexcept;
+};
+
+/**
+ * Does this header value contain folding line breaks?
+ */
+[[gnu::pure]]
+inline bool
+IsFoldedHeaderValue(std::string_view value) noexcept
+{
+	return value.find('\n') != value.npos;
+}
+
+/**
+ * Unfold a header value (RFC 5322 2.2.3), i.e. remove line breaks
+ * followed by whitespace.
+ */
+std::string
+UnfoldHeaderValue(std::string_view value);
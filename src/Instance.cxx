@@ -3,11 +3,14 @@
 // author: Max Kellermann <max.kellermann@ionos.com>
 
 #include "Instance.hxx"
+#include "Metrics.hxx"
+#include "lib/fmt/RuntimeError.hxx"
 #include "lua/net/SocketAddress.hxx"
 #include "net/ConnectSocket.hxx"
 #include "net/SocketConfig.hxx"
 #include "net/AllocatedSocketAddress.hxx"
 #include "net/log/Protocol.hxx"
+#include "util/Exception.hxx"
 #include "util/ScopeExit.hxx"
 
 extern "C" {
@@ -18,10 +21,17 @@ extern "C" {
 #include <systemd/sd-daemon.h>
 #endif
 
+#include <fmt/format.h>
+
+#include <cassert>
 #include <stdexcept>
 
 #include <errno.h>
+#include <stddef.h> // for offsetof()
 #include <string.h>
+#include <sys/un.h>
+
+using std::string_view_literals::operator""sv;
 
 Instance::Instance()
 	:sighup_event(event_loop, SIGHUP, BIND_THIS_METHOD(OnReload)),
@@ -31,28 +41,47 @@ Instance::Instance()
 	sighup_event.Enable();
 }
 
+Instance::~Instance() noexcept
+{
+	/* OnDrainTimeout() has canceled all secondary relays */
+	assert(fanout_relays.empty());
+}
+
+void
+Instance::EnableBytecodeCache(const char *path) noexcept
+try {
+	bytecode_cache.emplace(path);
+	bytecode_cache->Register(lua_state.get());
+} catch (...) {
+	logger(1, "Failed to open the bytecode cache: ",
+	       GetFullMessage(std::current_exception()));
+}
+
 inline void
 Instance::AddListener(UniqueSocketDescriptor &&fd,
-		      size_t max_size,
+		      ListenerConfig &config,
 		      Lua::ValuePtr &&handler) noexcept
 {
-	listeners.emplace_front(event_loop, *this, max_size, std::move(handler),
+	listeners.emplace_front(event_loop, *this, config, std::move(handler),
 				logger);
 	listeners.front().Listen(std::move(fd));
 }
 
 static UniqueSocketDescriptor
-MakeListener(SocketAddress address)
+MakeListener(SocketAddress address, const ListenerConfig &listener_config)
 {
 	constexpr int socktype = SOCK_STREAM;
 
+	const bool local = address.GetFamily() == AF_LOCAL;
+
 	const SocketConfig config{
 		.bind_address = AllocatedSocketAddress{address},
-		.listen = 64,
-		.mode = 0666,
+		.listen = listener_config.backlog,
+		.mode = local ? 0666 : 0,
+		.reuse_port = listener_config.reuse_port,
 
 		/* we want to receive the client's UID */
-		.pass_cred = true,
+		.pass_cred = local,
 	};
 
 	return config.Create(socktype);
@@ -60,17 +89,32 @@ MakeListener(SocketAddress address)
 
 void
 Instance::AddListener(SocketAddress address,
-		      size_t max_size,
+		      ListenerConfig &config,
 		      Lua::ValuePtr &&handler)
 {
-	AddListener(MakeListener(address), max_size, std::move(handler));
+	if (dry_run) {
+		dry_run_handlers.emplace_front(config, std::move(handler));
+		return;
+	}
+
+	auto fd = TakeHandoverSocket(address);
+	if (!fd.IsDefined())
+		fd = MakeListener(address, config);
+
+	AddListener(std::move(fd), config, std::move(handler));
 }
 
 #ifdef HAVE_LIBSYSTEMD
 
 void
-Instance::AddSystemdListener(size_t max_size, Lua::ValuePtr &&handler)
+Instance::AddSystemdListener(ListenerConfig &config,
+			     Lua::ValuePtr &&handler)
 {
+	if (dry_run) {
+		dry_run_handlers.emplace_front(config, std::move(handler));
+		return;
+	}
+
 	int n = sd_listen_fds(true);
 	if (n < 0) {
 		logger(1, "sd_listen_fds() failed: ", strerror(errno));
@@ -84,16 +128,123 @@ Instance::AddSystemdListener(size_t max_size, Lua::ValuePtr &&handler)
 
 	for (unsigned i = 0; i < unsigned(n); ++i)
 		AddListener(UniqueSocketDescriptor(AdoptTag{}, SD_LISTEN_FDS_START + i),
-			    max_size,
+			    config,
 			    Lua::ValuePtr(handler));
 }
 
 #endif // HAVE_LIBSYSTEMD
 
+void
+Instance::AddMetricsListener(SocketAddress address)
+{
+	if (dry_run)
+		return;
+
+	auto fd = TakeHandoverSocket(address);
+	if (!fd.IsDefined()) {
+		const SocketConfig config{
+			.bind_address = AllocatedSocketAddress{address},
+			.listen = 16,
+		};
+
+		fd = config.Create(SOCK_STREAM);
+	}
+
+	metrics_listeners.emplace_front(event_loop, *this);
+	metrics_listeners.front().Listen(std::move(fd));
+}
+
+DuplicateCache &
+Instance::AddDuplicateCache(std::string_view name, std::size_t capacity,
+			    Event::Duration ttl)
+{
+	for (const auto &i : duplicate_caches)
+		if (i.GetName() == name)
+			throw FmtRuntimeError("Duplicate cache name `{}`", name);
+
+	return duplicate_caches.emplace_front(name, capacity, ttl);
+}
+
+/**
+ * Compare a requested listener address with the local address of a
+ * socket.
+ */
+[[gnu::pure]]
+static bool
+IsSameAddress(SocketAddress a, SocketAddress b) noexcept
+{
+	if (a.GetFamily() != b.GetFamily())
+		return false;
+
+	if (a.GetFamily() == AF_LOCAL) {
+		/* compare only the paths, because the size returned
+		   by getsockname() may or may not include the null
+		   terminator */
+		const auto GetPath = [](SocketAddress address){
+			const auto &sun = *reinterpret_cast<const struct sockaddr_un *>(address.GetAddress());
+			std::string_view path{sun.sun_path, address.GetSize() - offsetof(struct sockaddr_un, sun_path)};
+			while (path.size() > 1 && path.back() == '\0')
+				path.remove_suffix(1);
+			return path;
+		};
+
+		return GetPath(a) == GetPath(b);
+	}
+
+	return a == b;
+}
+
+UniqueSocketDescriptor
+Instance::TakeHandoverSocket(SocketAddress address)
+{
+	if (handover_path.empty())
+		return {};
+
+	if (!handover_received) {
+		handover_received = true;
+		handover_sockets = handover_client.Receive(handover_path.c_str());
+		if (!handover_sockets.empty())
+			logger(2, "Received listening sockets from the predecessor");
+	}
+
+	for (auto prev = handover_sockets.before_begin(), i = std::next(prev);
+	     i != handover_sockets.end(); prev = i++) {
+		if (IsSameAddress(address, i->GetLocalAddress())) {
+			auto fd = std::move(*i);
+			handover_sockets.erase_after(prev);
+			return fd;
+		}
+	}
+
+	return {};
+}
+
+void
+Instance::SetupHandover()
+{
+	if (handover_path.empty())
+		return;
+
+	if (!handover_received) {
+		/* no listener has asked for a socket, but the
+		   predecessor must be told to exit anyway */
+		handover_received = true;
+		handover_sockets = handover_client.Receive(handover_path.c_str());
+	}
+
+	/* close the sockets which are not used by the new
+	   configuration */
+	handover_sockets.clear();
+
+	handover_client.Commit();
+
+	handover_server.emplace(event_loop, handover_path.c_str(), *this);
+}
+
 void
 Instance::Check()
 {
-	if (listeners.empty())
+	if (listeners.empty() && dry_run_handlers.empty())
 		throw std::runtime_error("No QMQP listeners configured");
 }
 
@@ -112,21 +263,247 @@ Instance::SetupLogSocket()
 }
 
 void
-Instance::OnShutdown() noexcept
+Instance::Start() noexcept
 {
+	loop_monitor.Start();
+	gc_scheduler.Start();
+}
+
+void
+Instance::WriteMetrics(std::string &out) const noexcept
+{
+	loop_monitor.WriteMetrics(out);
+	gc_scheduler.WriteMetrics(out);
+
+	WriteMetricHeader(out, "qrelay_handler_budget_exceeded_total"sv, "counter"sv,
+			  "Number of Lua handler invocations aborted because they exceeded the CPU budget"sv);
+	for (const auto &i : listener_configs)
+		WriteMetricSample(out, "qrelay_handler_budget_exceeded_total"sv,
+				  MakeMetricLabel("listener"sv, i.name),
+				  i.n_budget_exceeded);
+
+	WriteMetricHeader(out, "qrelay_receive_timeouts_total"sv, "counter"sv,
+			  "Number of connections closed because the client did not send its request in time"sv);
+	for (const auto &i : listener_configs) {
+		for (std::size_t reason = 0; reason < N_QMQP_RECEIVE_TIMEOUTS; ++reason) {
+			const auto labels = fmt::format("{},{}"sv,
+							MakeMetricLabel("listener"sv, i.name),
+							MakeMetricLabel("reason"sv, ToString(static_cast<QmqpReceiveTimeout>(reason))));
+			WriteMetricSample(out, "qrelay_receive_timeouts_total"sv,
+					  labels, i.n_receive_timeouts[reason]);
+		}
+	}
+
+	WriteMetricHeader(out, "qrelay_memfd_submissions_total"sv, "counter"sv,
+			  "Number of requests submitted in a sealed memfd"sv);
+	for (const auto &i : listener_configs)
+		WriteMetricSample(out, "qrelay_memfd_submissions_total"sv,
+				  MakeMetricLabel("listener"sv, i.name),
+				  i.n_memfd_submissions);
+
+	WriteMetricHeader(out, "qrelay_fanout_relays_total"sv, "counter"sv,
+			  "Number of finished secondary relays of fanout actions"sv);
+	for (std::size_t result = 0; result < N_FANOUT_RESULTS; ++result)
+		WriteMetricSample(out, "qrelay_fanout_relays_total"sv,
+				  MakeMetricLabel("result"sv, ToString(static_cast<FanoutResult>(result))),
+				  n_fanout_relays[result]);
+
+	if (bytecode_cache) {
+		WriteMetric(out, "qrelay_lua_bytecode_cache_hits_total"sv, "counter"sv,
+			    "Number of Lua files loaded from the bytecode cache"sv,
+			    bytecode_cache->GetHits());
+		WriteMetric(out, "qrelay_lua_bytecode_cache_misses_total"sv, "counter"sv,
+			    "Number of Lua files which had to be compiled"sv,
+			    bytecode_cache->GetMisses());
+		WriteMetric(out, "qrelay_lua_bytecode_cache_write_errors_total"sv, "counter"sv,
+			    "Number of compiled Lua files which could not be saved in the cache"sv,
+			    bytecode_cache->GetWriteErrors());
+	}
+
+	WriteMetric(out, "qrelay_cgroup_cache_hits_total"sv, "counter"sv,
+		    "Number of cgroup lookups answered from the cache"sv,
+		    cgroup_cache.GetHits());
+	WriteMetric(out, "qrelay_cgroup_cache_misses_total"sv, "counter"sv,
+		    "Number of cgroup lookups which had to read the cgroup filesystem"sv,
+		    cgroup_cache.GetMisses());
+	WriteMetric(out, "qrelay_cgroup_cache_invalidations_total"sv, "counter"sv,
+		    "Number of cgroup cache entries invalidated by inotify"sv,
+		    cgroup_cache.GetInvalidations());
+	WriteMetric(out, "qrelay_cgroup_cache_entries"sv, "gauge"sv,
+		    "Number of cgroups in the cache"sv,
+		    static_cast<uint_least64_t>(cgroup_cache.size()));
+
+	WriteMetric(out, "qrelay_resolver_cache_hits_total"sv, "counter"sv,
+		    "Number of host name lookups answered from the cache"sv,
+		    resolver_cache.GetHits());
+	WriteMetric(out, "qrelay_resolver_cache_misses_total"sv, "counter"sv,
+		    "Number of host name lookups which had to wait for the resolver"sv,
+		    resolver_cache.GetMisses());
+	WriteMetric(out, "qrelay_resolver_cache_refreshes_total"sv, "counter"sv,
+		    "Number of cached host names refreshed in the background"sv,
+		    resolver_cache.GetRefreshes());
+	WriteMetric(out, "qrelay_resolver_errors_total"sv, "counter"sv,
+		    "Number of failed host name lookups"sv,
+		    resolver_cache.GetErrors());
+
+	if (duplicate_caches.empty())
+		return;
+
+	WriteMetricHeader(out, "qrelay_duplicate_cache_lookups_total"sv, "counter"sv,
+			  "Number of duplicate cache lookups"sv);
+	for (const auto &i : duplicate_caches)
+		WriteMetricSample(out, "qrelay_duplicate_cache_lookups_total"sv,
+				  MakeMetricLabel("cache"sv, i.GetName()),
+				  i.GetLookups());
+
+	WriteMetricHeader(out, "qrelay_duplicate_cache_hits_total"sv, "counter"sv,
+			  "Number of submissions found in the duplicate cache"sv);
+	for (const auto &i : duplicate_caches)
+		WriteMetricSample(out, "qrelay_duplicate_cache_hits_total"sv,
+				  MakeMetricLabel("cache"sv, i.GetName()),
+				  i.GetHits());
+
+	WriteMetricHeader(out, "qrelay_duplicate_cache_evictions_total"sv, "counter"sv,
+			  "Number of duplicate cache entries replaced before they expired"sv);
+	for (const auto &i : duplicate_caches)
+		WriteMetricSample(out, "qrelay_duplicate_cache_evictions_total"sv,
+				  MakeMetricLabel("cache"sv, i.GetName()),
+				  i.GetEvictions());
+
+	WriteMetricHeader(out, "qrelay_duplicate_cache_memory_bytes"sv, "gauge"sv,
+			  "Memory allocated by the duplicate cache"sv);
+	for (const auto &i : duplicate_caches)
+		WriteMetricSample(out, "qrelay_duplicate_cache_memory_bytes"sv,
+				  MakeMetricLabel("cache"sv, i.GetName()),
+				  static_cast<uint_least64_t>(i.GetMemorySize()));
+}
+
+void
+Instance::StartDrain() noexcept
+{
+	if (draining)
+		return;
+
+	draining = true;
+
 	shutdown_listener.Disable();
 	sighup_event.Disable();
-	zombie_reaper.Disable();
+	handover_server.reset();
+
+	/* stop accepting new connections; if a successor has taken
+	   over the sockets, it continues to accept on them */
+	for (auto &i : listeners)
+		i.Close();
+	for (auto &i : metrics_listeners)
+		i.Close();
 
 #ifdef HAVE_LIBSYSTEMD
-	systemd_watchdog.Disable();
+	sd_notify(0, "STOPPING=1");
 #endif
 
+	if (IsIdle()) {
+		Exit();
+		return;
+	}
+
+	logger(2, fmt::format("Waiting for {} connections and {} fanout relays"sv,
+			      n_connections, fanout_relays.size()).c_str());
+	drain_timer.Schedule(drain_timeout);
+}
+
+void
+Instance::OnDrainTimeout() noexcept
+{
+	logger(1, fmt::format("Canceling {} connections and {} fanout relays"sv,
+			      n_connections, fanout_relays.size()).c_str());
+
+	/* finish the secondary relays which are still running, so
+	   their outcome is counted and logged; clear the flag first
+	   so CheckDrained() does not call Exit() meanwhile */
+	draining = false;
+	while (!fanout_relays.empty())
+		fanout_relays.front().Cancel();
+
+	Exit();
+}
+
+void
+Instance::Exit() noexcept
+{
+	/* connections which are destroyed after this point (by
+	   our destructor) shall not call Exit() again */
+	draining = false;
+	drain_timer.Cancel();
+
+	zombie_reaper.Disable();
+	loop_monitor.Stop();
+	gc_scheduler.Stop();
+	cgroup_cache.Disable();
+	resolver_cache.Disable();
+
 	event_loop.Break();
 }
 
+void
+Instance::OnShutdown() noexcept
+{
+	StartDrain();
+}
+
+std::vector<SocketDescriptor>
+Instance::GetHandoverSockets() const noexcept
+{
+	std::vector<SocketDescriptor> result;
+	for (const auto &i : listeners)
+		result.emplace_back(i.GetSocket());
+	for (const auto &i : metrics_listeners)
+		result.emplace_back(i.GetSocket());
+	return result;
+}
+
+void
+Instance::OnHandoverCommit() noexcept
+{
+	logger(2, "Handover to the successor complete");
+	StartDrain();
+}
+
+void
+Instance::OnHandoverError(std::exception_ptr error) noexcept
+{
+	logger(1, "Handover failed: ", GetFullMessage(error));
+}
+
 void
 Instance::OnReload(int) noexcept
 {
+	if (reload.IsRunning()) {
+		/* the coroutine may be waiting for something which
+		   cannot be canceled (e.g. blocklist:reload()) */
+		logger(2, "Reload is already running");
+		return;
+	}
+
+	reload_start_time = std::chrono::steady_clock::now();
+	reload_old_misses = bytecode_cache ? bytecode_cache->GetMisses() : 0;
+
+	/* this may invoke OnReloadFinished() right away */
 	reload.Start();
 }
+
+void
+Instance::OnReloadFinished(std::exception_ptr error) noexcept
+{
+	if (error)
+		logger(1, "Reload failed: ", GetFullMessage(error));
+
+	/* the reload may have replaced large tables; collect the old
+	   ones now instead of during the next handler invocations */
+	gc_scheduler.FullCollect();
+
+	const std::chrono::duration<double> duration =
+		std::chrono::steady_clock::now() - reload_start_time;
+	logger(2, fmt::format("Reload took {:.3f}s ({} Lua files compiled)"sv,
+			      duration.count(),
+			      bytecode_cache ? bytecode_cache->GetMisses() - reload_old_misses : 0).c_str());
+}
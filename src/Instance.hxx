@@ -4,25 +4,48 @@
 
 #pragma once
 
+#include "CgroupCache.hxx"
+#include "DuplicateCache.hxx"
+#include "FanoutRelay.hxx"
+#include "Handover.hxx"
+#include "ResolverCache.hxx"
 #include "Listener.hxx"
-#include "lua/ReloadRunner.hxx"
+#include "ListenerConfig.hxx"
+#include "LoopMonitor.hxx"
+#include "LuaBytecodeCache.hxx"
+#include "LuaGc.hxx"
+#include "LuaReloadRunner.hxx"
+#include "MetricsConnection.hxx"
 #include "lua/State.hxx"
 #include "lua/ValuePtr.hxx"
 #include "spawn/Terminator.hxx"
 #include "spawn/ZombieReaper.hxx"
 #include "net/UniqueSocketDescriptor.hxx"
 #include "io/Logger.hxx"
+#include "event/CoarseTimerEvent.hxx"
 #include "event/Loop.hxx"
 #include "event/ShutdownListener.hxx"
 #include "event/SignalEvent.hxx"
-#include "event/systemd/Watchdog.hxx"
 #include "config.h"
 
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <forward_list>
+#include <optional>
+#include <string>
 
 namespace Lua { class Value; }
 
-class Instance {
+/**
+ * A qmqp_listen() call recorded in "dry run" mode.
+ */
+struct DryRunHandler {
+	const ListenerConfig &config;
+	Lua::ValuePtr handler;
+};
+
+class Instance final : HandoverHandler {
 	EventLoop event_loop;
 	ShutdownListener shutdown_listener{event_loop, BIND_THIS_METHOD(OnShutdown)};
 	SignalEvent sighup_event;
@@ -30,22 +53,121 @@ class Instance {
 	ChildProcessTerminator child_process_terminator;
 	ZombieReaper zombie_reaper{event_loop};
 
-#ifdef HAVE_LIBSYSTEMD
-	Systemd::Watchdog systemd_watchdog{event_loop};
-#endif
+	/**
+	 * Also sends the systemd watchdog keep-alive notifications.
+	 */
+	LoopMonitor loop_monitor{event_loop};
+
+	/**
+	 * Compiled Lua code in $CACHE_DIRECTORY; must be declared
+	 * before #lua_state because its module searcher refers to
+	 * it.
+	 */
+	std::optional<LuaBytecodeCache> bytecode_cache;
 
 	Lua::State lua_state;
 
-	Lua::ReloadRunner reload{lua_state.get()};
+	LuaReloadRunner reload{lua_state.get(), BIND_THIS_METHOD(OnReloadFinished)};
+
+	/**
+	 * When the current reload was started and the number of
+	 * bytecode cache misses at that time (for the log message
+	 * in OnReloadFinished()).
+	 */
+	std::chrono::steady_clock::time_point reload_start_time;
+	std::size_t reload_old_misses = 0;
+
+	LuaGcScheduler gc_scheduler{event_loop, lua_state.get()};
 
 	UniqueSocketDescriptor log_socket;
 
+	std::forward_list<ListenerConfig> listener_configs;
 	std::forward_list<QmqpRelayListener> listeners;
 
+	std::forward_list<MetricsListener> metrics_listeners;
+
+	/**
+	 * Shared by all connections; used by the Lua attribute
+	 * "m.cgroup".
+	 */
+	CgroupCache cgroup_cache{event_loop};
+
+	/**
+	 * Used by the Lua method "m:resolve()".
+	 */
+	ResolverCache resolver_cache{event_loop};
+
+	/**
+	 * Created by the Lua function duplicate_cache().  They live
+	 * as long as this object, because mails which are being
+	 * relayed may refer to them.
+	 */
+	std::forward_list<DuplicateCache> duplicate_caches;
+
+	/**
+	 * The number of #QmqpRelayConnection instances.
+	 */
+	std::size_t n_connections = 0;
+
+	/**
+	 * Secondary relays of "fanout" actions which are still
+	 * running.  They are not owned by any connection, but
+	 * shutdown waits for them just like for connections.
+	 */
+	IntrusiveList<FanoutRelay> fanout_relays;
+
+	/**
+	 * The number of finished #FanoutRelay instances, indexed by
+	 * #FanoutResult.
+	 */
+	std::array<uint_least64_t, N_FANOUT_RESULTS> n_fanout_relays{};
+
+	/**
+	 * After shutdown has been requested, we wait this long for
+	 * in-flight submissions before exiting.
+	 */
+	Event::Duration drain_timeout = std::chrono::seconds{30};
+
+	CoarseTimerEvent drain_timer{event_loop, BIND_THIS_METHOD(OnDrainTimeout)};
+
+	/**
+	 * Set after shutdown has been requested: we don't accept new
+	 * connections and exit as soon as #n_connections drops to
+	 * zero.
+	 */
+	bool draining = false;
+
+	/**
+	 * The path of the handover socket (command-line option
+	 * "--handover"); empty if disabled.
+	 */
+	std::string handover_path;
+
+	HandoverClient handover_client;
+
+	/**
+	 * Listening sockets received from our predecessor which have
+	 * not yet been claimed by qmqp_listen() or metrics_listen().
+	 */
+	std::forward_list<UniqueSocketDescriptor> handover_sockets;
+
+	bool handover_received = false;
+
+	std::optional<HandoverServer> handover_server;
+
+	/**
+	 * In "dry run" mode, no sockets are created; qmqp_listen()
+	 * only records its handlers here.
+	 */
+	std::forward_list<DryRunHandler> dry_run_handlers;
+
+	bool dry_run = false;
+
 public:
 	RootLogger logger;
 
 	Instance();
+	~Instance() noexcept;
 
 	EventLoop &GetEventLoop() {
 		return event_loop;
@@ -63,12 +185,96 @@ public:
 		return log_socket;
 	}
 
+	auto &GetLoopMonitor() noexcept {
+		return loop_monitor;
+	}
+
+	auto &GetLuaGc() noexcept {
+		return gc_scheduler;
+	}
+
+	const auto &GetReloadRunner() const noexcept {
+		return reload;
+	}
+
+	auto &GetCgroupCache() noexcept {
+		return cgroup_cache;
+	}
+
+	auto &GetResolverCache() noexcept {
+		return resolver_cache;
+	}
+
+	/**
+	 * Enable "dry run" mode: the configuration does not create
+	 * any sockets.  This is used by the benchmark mode.
+	 */
+	void SetDryRun() noexcept {
+		dry_run = true;
+	}
+
+	const auto &GetDryRunHandlers() const noexcept {
+		return dry_run_handlers;
+	}
+
+	/**
+	 * Load Lua code through a #LuaBytecodeCache in the specified
+	 * directory.  Errors are logged, and the cache is disabled.
+	 */
+	void EnableBytecodeCache(const char *path) noexcept;
+
+	LuaBytecodeCache *GetBytecodeCache() noexcept {
+		return bytecode_cache ? &*bytecode_cache : nullptr;
+	}
+
+	/**
+	 * Take over listening sockets from a running qrelay process
+	 * through the specified handover socket, and listen on it for
+	 * a successor.
+	 */
+	void SetHandoverPath(const char *path) noexcept {
+		handover_path = path;
+	}
+
+	void SetDrainTimeout(Event::Duration _drain_timeout) noexcept {
+		drain_timeout = _drain_timeout;
+	}
+
+	void OnConnectionCreated() noexcept {
+		++n_connections;
+	}
+
+	void OnConnectionDestroyed() noexcept {
+		--n_connections;
+		CheckDrained();
+	}
+
+	void OnFanoutRelayCreated(FanoutRelay &relay) noexcept {
+		fanout_relays.push_back(relay);
+	}
+
+	void OnFanoutRelayFinished(FanoutResult result) noexcept {
+		++n_fanout_relays[static_cast<std::size_t>(result)];
+	}
+
+	void OnFanoutRelayDestroyed() noexcept {
+		CheckDrained();
+	}
+
+	/**
+	 * Create a new #ListenerConfig which can be passed to
+	 * AddListener().  Its lifetime is managed by this class.
+	 */
+	ListenerConfig &MakeListenerConfig(ListenerConfig &&config) noexcept {
+		return listener_configs.emplace_front(std::move(config));
+	}
+
 	void AddListener(UniqueSocketDescriptor &&fd,
-			 size_t max_size,
+			 ListenerConfig &config,
 			 Lua::ValuePtr &&handler) noexcept;
 
 	void AddListener(SocketAddress address,
-			 size_t max_size,
+			 ListenerConfig &config,
 			 Lua::ValuePtr &&handler);
 
 #ifdef HAVE_LIBSYSTEMD
@@ -76,13 +282,81 @@ public:
 	 * Listen for incoming connections on sockets passed by systemd
 	 * (systemd socket activation).
 	 */
-	void AddSystemdListener(size_t max_size, Lua::ValuePtr &&handler);
+	void AddSystemdListener(ListenerConfig &config,
+				Lua::ValuePtr &&handler);
 #endif // HAVE_LIBSYSTEMD
 
+	/**
+	 * Listen for HTTP requests on the specified address and
+	 * respond with metrics in the Prometheus text format.
+	 */
+	void AddMetricsListener(SocketAddress address);
+
+	/**
+	 * Create a new #DuplicateCache.  Throws if the name is
+	 * already in use.
+	 */
+	DuplicateCache &AddDuplicateCache(std::string_view name,
+					  std::size_t capacity,
+					  Event::Duration ttl);
+
 	void Check();
 	void SetupLogSocket();
 
+	/**
+	 * Finish the handover from our predecessor (which will then
+	 * stop accepting connections) and listen for a successor.
+	 * This is called after the configuration has been loaded.
+	 */
+	void SetupHandover();
+
+	/**
+	 * Start background tasks after the configuration has been
+	 * loaded, right before the #EventLoop is run.
+	 */
+	void Start() noexcept;
+
+	/**
+	 * Append all metrics in the Prometheus text format.
+	 */
+	void WriteMetrics(std::string &out) const noexcept;
+
 private:
+	/**
+	 * If sockets have been handed over by our predecessor, look
+	 * for one bound to the specified address.
+	 *
+	 * @return the socket or an undefined object
+	 */
+	UniqueSocketDescriptor TakeHandoverSocket(SocketAddress address);
+
+	/**
+	 * Stop accepting new connections and exit once all in-flight
+	 * submissions are done (or #drain_timeout has passed).
+	 */
+	void StartDrain() noexcept;
+
+	bool IsIdle() const noexcept {
+		return n_connections == 0 && fanout_relays.empty();
+	}
+
+	/**
+	 * If draining, exit if the last submission has finished.
+	 */
+	void CheckDrained() noexcept {
+		if (draining && IsIdle())
+			Exit();
+	}
+
+	void Exit() noexcept;
+
+	void OnDrainTimeout() noexcept;
 	void OnShutdown() noexcept;
 	void OnReload(int) noexcept;
+	void OnReloadFinished(std::exception_ptr error) noexcept;
+
+	/* virtual methods from class HandoverHandler */
+	std::vector<SocketDescriptor> GetHandoverSockets() const noexcept override;
+	void OnHandoverCommit() noexcept override;
+	void OnHandoverError(std::exception_ptr error) noexcept override;
 };
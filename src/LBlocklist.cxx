@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LBlocklist.hxx"
+#include "Blocklist.hxx"
+#include "BlocklistLoader.hxx"
+#include "Instance.hxx"
+#include "LMail.hxx"
+#include "MutableMail.hxx"
+#include "lua/Class.hxx"
+#include "lua/Error.hxx"
+#include "lua/LightUserData.hxx"
+#include "lua/PushCClosure.hxx"
+#include "lua/Resume.hxx"
+#include "lua/StringView.hxx"
+#include "lua/Util.hxx"
+#include "util/Exception.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+struct LuaBlocklistFile final : BlocklistLoaderHandler {
+	Instance &instance;
+
+	/**
+	 * The path passed to blocklist_open(), used by reload().
+	 */
+	const std::string path;
+
+	Blocklist blocklist;
+
+	/**
+	 * Loads the new #Blocklist while a reload() call is pending.
+	 */
+	std::unique_ptr<BlocklistLoader> loader;
+
+	/**
+	 * The coroutine which called reload(); it is resumed when
+	 * #loader finishes.  This is always the "reload" coroutine
+	 * of #LuaReloadRunner, which is never canceled while it
+	 * waits.
+	 */
+	lua_State *reload_thread = nullptr;
+
+	LuaBlocklistFile(Instance &_instance,
+			 const char *_path, Blocklist &&_blocklist) noexcept
+		:instance(_instance),
+		 path(_path), blocklist(std::move(_blocklist)) {}
+
+	/* virtual methods from class BlocklistLoaderHandler */
+	void OnBlocklistLoaded(Blocklist &&_blocklist) noexcept override {
+		blocklist = std::move(_blocklist);
+		loader.reset();
+
+		const auto L = std::exchange(reload_thread, nullptr);
+		lua_pushboolean(L, true);
+		Lua::Resume(L, 1);
+	}
+
+	void OnBlocklistError(std::exception_ptr error) noexcept override {
+		loader.reset();
+
+		const auto L = std::exchange(reload_thread, nullptr);
+		lua_pushnil(L);
+		Lua::Push(L, std::string_view{GetFullMessage(error)});
+		Lua::Resume(L, 2);
+	}
+};
+
+static constexpr char lua_blocklist_class[] = "qrelay.blocklist";
+typedef Lua::Class<LuaBlocklistFile, lua_blocklist_class> LuaBlocklist;
+
+static int
+BlocklistContains(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	const auto &blocklist = LuaBlocklist::Cast(L, 1).blocklist;
+	const auto key = Lua::CheckStringView(L, 2);
+
+	lua_pushboolean(L, blocklist.ContainsAddress(key));
+	return 1;
+}
+
+/**
+ * Check a list of addresses (a table or a mail object whose
+ * recipients shall be checked) and return the first one which is
+ * in the blocklist (or nil).
+ */
+static int
+BlocklistContainsAny(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	const auto &blocklist = LuaBlocklist::Cast(L, 1).blocklist;
+
+	if (const auto *mail = CheckLuaMail(L, 2)) {
+		/* check the recipients directly, without
+		   converting them to a Lua table first */
+		const auto i = blocklist.FindAny(mail->recipients);
+		if (i == SIZE_MAX)
+			return 0;
+
+		Lua::Push(L, mail->recipients[i]);
+		return 1;
+	}
+
+	luaL_checktype(L, 2, LUA_TTABLE);
+
+	const std::size_t n = lua_objlen(L, 2);
+	for (std::size_t i = 1; i <= n; ++i) {
+		lua_rawgeti(L, 2, i);
+		if (lua_type(L, -1) != LUA_TSTRING)
+			return luaL_argerror(L, 2, "string expected");
+
+		if (blocklist.ContainsAddress(Lua::ToStringView(L, -1)))
+			return 1;
+
+		lua_pop(L, 1);
+	}
+
+	return 0;
+}
+
+/**
+ * Start loading the new blocklist on a helper thread and suspend
+ * the calling coroutine until it is done.
+ */
+static int
+StartBlocklistReload(lua_State *L, LuaBlocklistFile &file)
+try {
+	file.loader = std::make_unique<BlocklistLoader>(file.instance.GetEventLoop(),
+							file.path.c_str(),
+							file);
+	file.reload_thread = L;
+	return lua_yield(L, 0);
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+/**
+ * Load the file again (after it has been replaced).  The new
+ * blocklist is swapped in only after it has been loaded
+ * successfully; on error, the old one remains in use.
+ *
+ * Inside the "reload" function, the file is loaded on a helper
+ * thread and the coroutine is suspended meanwhile; the main thread
+ * cannot yield, so there, it is loaded synchronously.  Other
+ * coroutines (i.e. handlers) may not call this method, because they
+ * may be canceled (e.g. when the client disconnects) while waiting
+ * for the helper thread.
+ *
+ * Returns true on success or nil and an error message.
+ */
+static int
+BlocklistReload(lua_State *L)
+{
+	if (lua_gettop(L) != 1)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &file = LuaBlocklist::Cast(L, 1);
+	if (file.loader)
+		return luaL_error(L, "Already reloading");
+
+	const bool is_main_thread = lua_pushthread(L);
+	lua_pop(L, 1);
+
+	if (!is_main_thread) {
+		if (!file.instance.GetReloadRunner().IsThread(L))
+			return luaL_error(L, "reload() is only allowed in the reload function");
+
+		return StartBlocklistReload(L, file);
+	}
+
+	try {
+		file.blocklist = Blocklist{file.path.c_str()};
+	} catch (...) {
+		lua_pushnil(L);
+		Lua::Push(L, std::string_view{GetFullMessage(std::current_exception())});
+		return 2;
+	}
+
+	lua_pushboolean(L, true);
+	return 1;
+}
+
+static constexpr struct luaL_Reg blocklist_methods [] = {
+	{"contains", BlocklistContains},
+	{"contains_any", BlocklistContainsAny},
+	{"reload", BlocklistReload},
+	{nullptr, nullptr}
+};
+
+static int
+l_blocklist_open(lua_State *L)
+try {
+	auto &instance = *(Instance *)lua_touserdata(L, lua_upvalueindex(1));
+
+	if (lua_gettop(L) != 1)
+		return luaL_error(L, "Invalid parameter count");
+
+	const char *path = luaL_checkstring(L, 1);
+
+	/* load the file before allocating the Lua object, because
+	   this may throw */
+	Blocklist blocklist{path};
+
+	LuaBlocklist::New(L, instance, path, std::move(blocklist));
+	return 1;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+void
+RegisterLuaBlocklist(lua_State *L, Instance &instance)
+{
+	LuaBlocklist::Register(L);
+
+	lua_newtable(L);
+	luaL_register(L, nullptr, blocklist_methods);
+	lua_setfield(L, -2, "__index");
+
+	lua_pop(L, 1);
+
+	Lua::SetGlobal(L, "blocklist_open",
+		       Lua::MakeCClosure(l_blocklist_open,
+					 Lua::LightUserData(&instance)));
+}
+
+void
+UnregisterLuaBlocklist(lua_State *L)
+{
+	Lua::SetGlobal(L, "blocklist_open", nullptr);
+}
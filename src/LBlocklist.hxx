@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+struct lua_State;
+class Instance;
+
+/**
+ * Register the "blocklist" class and the global function
+ * blocklist_open().
+ *
+ * @param instance used by reload() to wait for the helper thread
+ * in the "reload" coroutine
+ */
+void
+RegisterLuaBlocklist(lua_State *L, Instance &instance);
+
+/**
+ * Remove the global function blocklist_open(); blocklists can only
+ * be opened while the configuration is loaded (but they can be
+ * reloaded at any time).
+ */
+void
+UnregisterLuaBlocklist(lua_State *L);
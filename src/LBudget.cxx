@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LBudget.hxx"
+#include "event/Loop.hxx"
+
+extern "C" {
+#include <lua.h>
+#include <lauxlib.h>
+}
+
+#if __has_include(<luajit.h>)
+#include <luajit.h>
+#endif
+
+/**
+ * Check the budget every this many Lua VM instructions.
+ */
+static constexpr int BUDGET_HOOK_COUNT = 1000;
+
+/**
+ * The address of this variable is the registry key of a table which
+ * maps coroutines (light user data) to #LuaBudget pointers.
+ */
+static int budget_table_key;
+
+static bool
+GetBudgetTable(lua_State *L) noexcept
+{
+	lua_pushlightuserdata(L, &budget_table_key);
+	lua_rawget(L, LUA_REGISTRYINDEX);
+	if (lua_istable(L, -1))
+		return true;
+
+	lua_pop(L, 1);
+	return false;
+}
+
+static void
+PushBudgetTable(lua_State *L) noexcept
+{
+	if (GetBudgetTable(L))
+		return;
+
+	lua_newtable(L);
+	lua_pushlightuserdata(L, &budget_table_key);
+	lua_pushvalue(L, -2);
+	lua_rawset(L, LUA_REGISTRYINDEX);
+}
+
+static LuaBudget *
+FindLuaBudget(lua_State *L) noexcept
+{
+	if (!GetBudgetTable(L))
+		return nullptr;
+
+	lua_pushlightuserdata(L, L);
+	lua_rawget(L, -2);
+	auto *budget = (LuaBudget *)lua_touserdata(L, -1);
+	lua_pop(L, 2);
+	return budget;
+}
+
+static void
+BudgetHook(lua_State *L, lua_Debug *)
+{
+	/* with LuaJIT, hooks are global, therefore this may be called
+	   for coroutines which have no budget */
+	auto *budget = FindLuaBudget(L);
+	if (budget == nullptr)
+		return;
+
+	const auto slice_id = budget->event_loop.SteadyNow();
+	if (slice_id != budget->slice_id) {
+		/* resumed by somebody who did not call StartSlice()
+		   (e.g. a library function which has yielded); start
+		   measuring now */
+		budget->StartSlice();
+		return;
+	}
+
+	if (Event::Clock::now() - budget->slice_start < budget->limit)
+		return;
+
+	budget->exceeded = true;
+	luaL_error(L, "CPU budget exceeded");
+}
+
+void
+LuaBudget::StartSlice() noexcept
+{
+	slice_id = event_loop.SteadyNow();
+	slice_start = Event::Clock::now();
+}
+
+void
+DisableLuaJitForBudget([[maybe_unused]] lua_State *L,
+		       [[maybe_unused]] int idx) noexcept
+{
+#ifdef LUAJIT_VERSION
+	/* this also flushes the traces of these functions */
+	luaJIT_setmode(L, idx, LUAJIT_MODE_ALLFUNC|LUAJIT_MODE_OFF);
+#endif
+}
+
+void
+SetLuaBudget(lua_State *thread, LuaBudget &budget) noexcept
+{
+	PushBudgetTable(thread);
+	lua_pushlightuserdata(thread, thread);
+	lua_pushlightuserdata(thread, &budget);
+	lua_rawset(thread, -3);
+	lua_pop(thread, 1);
+
+	lua_sethook(thread, BudgetHook, LUA_MASKCOUNT, BUDGET_HOOK_COUNT);
+}
+
+void
+UnsetLuaBudget(lua_State *thread) noexcept
+{
+	if (!GetBudgetTable(thread))
+		return;
+
+	lua_pushlightuserdata(thread, thread);
+	lua_pushnil(thread);
+	lua_rawset(thread, -3);
+
+#ifdef LUAJIT_VERSION
+	/* with LuaJIT, hooks are global; keep it as long as another
+	   coroutine has a budget */
+	lua_pushnil(thread);
+	if (lua_next(thread, -2) != 0) {
+		lua_pop(thread, 3);
+		return;
+	}
+#endif
+
+	lua_pop(thread, 1);
+	lua_sethook(thread, nullptr, 0, 0);
+}
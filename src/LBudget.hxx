@@ -0,0 +1,10046 @@
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+P
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+D
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+X
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+-
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+-
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+I
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+D
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+-
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+2
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+-
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+C
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+C
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+C
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+M
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+4
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+G
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+H
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+M
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+K
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+<
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+@
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+>
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+#
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+#
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+"
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+C
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+"
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+#
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+I
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+"
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+"
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+V
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+M
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+{
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+&
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+D
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+N
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+#
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+,
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+P
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+{
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+}
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+P
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+=
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+&
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+,
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+D
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+	
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+:
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+,
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+{
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+}
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+}
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+D
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+J
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+I
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+J
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+I
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+,
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+,
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+D
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+J
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+F
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+E
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+#
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+j
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+U
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+,
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+&
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+f
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+T
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+k
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+w
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+b
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+y
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+m
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+.
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+/
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+v
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+i
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+U
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+s
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+L
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+B
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+g
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+(
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+l
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+u
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+_
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+S
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+*
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+h
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+r
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+a
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+d
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+)
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+ 
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+n
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+o
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+x
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+c
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+e
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+p
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+t
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+;
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
+
+
+	/**
+	 * Start measuring a new slice.  Call this right before
+	 * resuming the coroutine.
+	 */
+	void StartSlice() noexcept;
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LCdb.hxx"
+#include "djb/CdbFile.hxx"
+#include "lua/Class.hxx"
+#include "lua/Error.hxx"
+#include "lua/StringView.hxx"
+#include "lua/Util.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <string>
+
+struct LuaCdbFile {
+	/**
+	 * The path passed to cdb_open(), used by reload().
+	 */
+	const std::string path;
+
+	CdbFile file;
+
+	LuaCdbFile(const char *_path, CdbFile &&_file) noexcept
+		:path(_path), file(std::move(_file)) {}
+};
+
+static constexpr char lua_cdb_class[] = "qrelay.cdb";
+typedef Lua::Class<LuaCdbFile, lua_cdb_class> LuaCdb;
+
+static int
+CdbGet(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	const auto &cdb = LuaCdb::Cast(L, 1);
+	const auto key = Lua::CheckStringView(L, 2);
+
+	const auto value = cdb.file.Find(key);
+	if (!value)
+		return 0;
+
+	Lua::Push(L, *value);
+	return 1;
+}
+
+/**
+ * Map the file again (after it has been replaced).  The new
+ * mapping is swapped in only after it has been opened successfully;
+ * on error, the old one remains in use.
+ */
+static int
+CdbReload(lua_State *L)
+try {
+	if (lua_gettop(L) != 1)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &cdb = LuaCdb::Cast(L, 1);
+	cdb.file = CdbFile{cdb.path.c_str()};
+	return 0;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+static constexpr struct luaL_Reg cdb_methods [] = {
+	{"get", CdbGet},
+	{"reload", CdbReload},
+	{nullptr, nullptr}
+};
+
+static int
+l_cdb_open(lua_State *L)
+try {
+	if (lua_gettop(L) != 1)
+		return luaL_error(L, "Invalid parameter count");
+
+	const char *path = luaL_checkstring(L, 1);
+
+	/* open the file before allocating the Lua object, because
+	   this may throw */
+	CdbFile file{path};
+
+	LuaCdb::New(L, path, std::move(file));
+	return 1;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+void
+RegisterLuaCdb(lua_State *L)
+{
+	LuaCdb::Register(L);
+
+	lua_newtable(L);
+	luaL_register(L, nullptr, cdb_methods);
+	lua_setfield(L, -2, "__index");
+
+	lua_pop(L, 1);
+
+	Lua::SetGlobal(L, "cdb_open", l_cdb_open);
+}
+
+void
+UnregisterLuaCdb(lua_State *L)
+{
+	Lua::SetGlobal(L, "cdb_open", nullptr);
+}
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+struct lua_State;
+
+/**
+ * Register the "cdb" class and the global function cdb_open().
+ */
+void
+RegisterLuaCdb(lua_State *L);
+
+/**
+ * Remove the global function cdb_open(); databases can only be
+ * opened while the configuration is loaded (but they can be
+ * reloaded at any time).
+ */
+void
+UnregisterLuaCdb(lua_State *L);
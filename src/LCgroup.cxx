@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LCgroup.hxx"
+#include "lua/Class.hxx"
+#include "lua/FenvCache.hxx"
+#include "lua/StringView.hxx"
+#include "lua/Util.hxx"
+#include "util/StringAPI.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+struct LuaCgroupInfo {
+	const std::shared_ptr<const CgroupCache::Entry> entry;
+
+	explicit LuaCgroupInfo(std::shared_ptr<const CgroupCache::Entry> &&_entry) noexcept
+		:entry(std::move(_entry)) {}
+};
+
+static constexpr char lua_cgroup_class[] = "qrelay.cgroup";
+typedef Lua::Class<LuaCgroupInfo, lua_cgroup_class> LuaCgroup;
+
+static int
+CgroupIndex(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	const auto &entry = *LuaCgroup::Cast(L, 1).entry;
+	constexpr Lua::StackIndex name_idx{2};
+	const char *const name = luaL_checkstring(L, 2);
+
+	// look it up in the fenv (our cache)
+	if (Lua::GetFenvCache(L, 1, name_idx))
+		return 1;
+
+	if (StringIsEqual(name, "path")) {
+		Lua::Push(L, std::string_view{entry.path});
+		return 1;
+	} else if (StringIsEqual(name, "xattr")) {
+		lua_createtable(L, 0, entry.xattr.size());
+		for (const auto &[key, value] : entry.xattr)
+			Lua::SetField(L, Lua::RelativeStackIndex{-1},
+				      key.c_str(), std::string_view{value});
+
+		// copy a reference to the fenv (our cache)
+		Lua::SetFenvCache(L, 1, name_idx, Lua::RelativeStackIndex{-1});
+		return 1;
+	} else if (StringIsEqual(name, "parent")) {
+		if (!entry.parent)
+			return 0;
+
+		NewLuaCgroup(L, entry.parent);
+
+		// copy a reference to the fenv (our cache)
+		Lua::SetFenvCache(L, 1, name_idx, Lua::RelativeStackIndex{-1});
+		return 1;
+	} else
+		return luaL_error(L, "Unknown attribute");
+}
+
+static int
+CgroupToString(lua_State *L)
+{
+	Lua::Push(L, std::string_view{LuaCgroup::Cast(L, 1).entry->path});
+	return 1;
+}
+
+void
+RegisterLuaCgroup(lua_State *L)
+{
+	using namespace Lua;
+
+	LuaCgroup::Register(L);
+	SetField(L, RelativeStackIndex{-1}, "__index", CgroupIndex);
+	SetField(L, RelativeStackIndex{-1}, "__tostring", CgroupToString);
+	lua_pop(L, 1);
+}
+
+void
+NewLuaCgroup(lua_State *L, std::shared_ptr<const CgroupCache::Entry> entry)
+{
+	LuaCgroup::New(L, std::move(entry));
+
+	lua_newtable(L);
+	lua_setfenv(L, -2);
+}
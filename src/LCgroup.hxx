@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "CgroupCache.hxx"
+
+#include <memory>
+
+struct lua_State;
+
+void
+RegisterLuaCgroup(lua_State *L);
+
+/**
+ * Push a new Lua object describing the specified cgroup.  It keeps
+ * a reference to the cache entry, so no filesystem access is needed
+ * to read its attributes.
+ */
+void
+NewLuaCgroup(lua_State *L, std::shared_ptr<const CgroupCache::Entry> entry);
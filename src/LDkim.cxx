@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LDkim.hxx"
+#include "Dkim.hxx"
+#include "lua/Class.hxx"
+#include "lua/Error.hxx"
+#include "lua/StringView.hxx"
+#include "lua/Util.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <string>
+
+static constexpr char lua_dkim_key_class[] = "qrelay.dkim_key";
+typedef Lua::Class<DkimKey, lua_dkim_key_class> LuaDkimKey;
+
+static int
+l_dkim_key(lua_State *L)
+try {
+	if (lua_gettop(L) != 3)
+		return luaL_error(L, "Invalid parameter count");
+
+	const auto domain = Lua::CheckStringView(L, 1);
+	const auto selector = Lua::CheckStringView(L, 2);
+	const std::string path{Lua::CheckStringView(L, 3)};
+
+	auto &key = *LuaDkimKey::New(L);
+	LoadDkimKey(key, domain, selector, path.c_str());
+	return 1;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+void
+RegisterLuaDkim(lua_State *L)
+{
+	LuaDkimKey::Register(L);
+	lua_pop(L, 1);
+
+	Lua::SetGlobal(L, "dkim_key", l_dkim_key);
+}
+
+void
+UnregisterLuaDkim(lua_State *L)
+{
+	Lua::SetGlobal(L, "dkim_key", nullptr);
+}
+
+const DkimKey &
+CheckLuaDkimKey(lua_State *L, int idx)
+{
+	return LuaDkimKey::Cast(L, idx);
+}
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+struct lua_State;
+struct DkimKey;
+
+/**
+ * Register the "dkim_key" class and the global function dkim_key()
+ * which loads a #DkimKey.
+ */
+void
+RegisterLuaDkim(lua_State *L);
+
+/**
+ * Remove the global function dkim_key(); keys can only be loaded
+ * while the configuration is loaded.
+ */
+void
+UnregisterLuaDkim(lua_State *L);
+
+/**
+ * Raises a Lua error if the value is not a dkim_key() object.
+ */
+const DkimKey &
+CheckLuaDkimKey(lua_State *L, int idx);
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LDuplicateCache.hxx"
+#include "DuplicateCache.hxx"
+#include "Instance.hxx"
+#include "lua/Class.hxx"
+#include "lua/Error.hxx"
+#include "lua/ForEach.hxx"
+#include "lua/LightUserData.hxx"
+#include "lua/PushCClosure.hxx"
+#include "lua/StringView.hxx"
+#include "lua/Util.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <cmath> // for std::isnormal()
+#include <stdexcept>
+
+using std::string_view_literals::operator""sv;
+
+/**
+ * The Lua object only refers to the #DuplicateCache; it is owned
+ * by the #Instance, because mails being relayed may still need it
+ * after the Lua object has been collected.
+ */
+struct LuaDuplicateCacheRef {
+	DuplicateCache &cache;
+};
+
+static constexpr char lua_duplicate_cache_class[] = "qrelay.duplicate_cache";
+typedef Lua::Class<LuaDuplicateCacheRef, lua_duplicate_cache_class> LuaDuplicateCache;
+
+static constexpr std::size_t DEFAULT_CAPACITY = 65536;
+static constexpr Event::Duration DEFAULT_TTL = std::chrono::minutes{10};
+
+/**
+ * Collect parameters from the "options" table passed as the last
+ * parameter to duplicate_cache().
+ */
+static void
+CollectDuplicateCacheOptions(lua_State *L, Lua::AnyStackIndex auto idx,
+			     std::size_t &capacity, Event::Duration &ttl)
+{
+	Lua::ForEach(L, idx, [L, &capacity, &ttl](auto key_idx, auto value_idx){
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) != LUA_TSTRING)
+			throw std::runtime_error("Option key is not a string");
+
+		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
+		if (!lua_isnumber(L, Lua::GetStackIndex(value_idx)))
+			throw std::runtime_error("Option value is not a number");
+
+		const auto value = lua_tonumber(L, Lua::GetStackIndex(value_idx));
+
+		if (key == "size"sv) {
+			if (value < 1 || value > 64 * 1024 * 1024)
+				throw std::runtime_error("Bad `size` value");
+
+			capacity = static_cast<std::size_t>(value);
+		} else if (key == "ttl"sv) {
+			if (!std::isnormal(value) || value <= 0 || value > 7 * 24 * 3600)
+				throw std::runtime_error("Bad `ttl` value");
+
+			ttl = std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{value});
+		} else
+			throw std::runtime_error("Unknown option");
+	});
+}
+
+static int
+l_duplicate_cache(lua_State *L)
+try {
+	auto &instance = *(Instance *)lua_touserdata(L, lua_upvalueindex(1));
+
+	const int top = lua_gettop(L);
+	if (top < 1 || top > 2)
+		return luaL_error(L, "Invalid parameter count");
+
+	const auto name = Lua::CheckStringView(L, 1);
+
+	std::size_t capacity = DEFAULT_CAPACITY;
+	Event::Duration ttl = DEFAULT_TTL;
+
+	if (top >= 2) {
+		if (!lua_istable(L, 2))
+			return luaL_argerror(L, 2, "table expected");
+
+		CollectDuplicateCacheOptions(L, Lua::StackIndex{2},
+					     capacity, ttl);
+	}
+
+	auto &cache = instance.AddDuplicateCache(name, capacity, ttl);
+	LuaDuplicateCache::New(L, cache);
+	return 1;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+void
+RegisterLuaDuplicateCache(lua_State *L, Instance &instance)
+{
+	LuaDuplicateCache::Register(L);
+	lua_pop(L, 1);
+
+	Lua::SetGlobal(L, "duplicate_cache",
+		       Lua::MakeCClosure(l_duplicate_cache,
+					 Lua::LightUserData(&instance)));
+}
+
+void
+UnregisterLuaDuplicateCache(lua_State *L)
+{
+	Lua::SetGlobal(L, "duplicate_cache", nullptr);
+}
+
+DuplicateCache &
+CheckLuaDuplicateCache(lua_State *L, int idx)
+{
+	return LuaDuplicateCache::Cast(L, idx).cache;
+}
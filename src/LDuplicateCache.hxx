@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+struct lua_State;
+class Instance;
+class DuplicateCache;
+
+/**
+ * Register the global function duplicate_cache() which creates a
+ * #DuplicateCache owned by the #Instance.
+ */
+void
+RegisterLuaDuplicateCache(lua_State *L, Instance &instance);
+
+/**
+ * Remove the global function duplicate_cache(); caches can only be
+ * created while the configuration is loaded.
+ */
+void
+UnregisterLuaDuplicateCache(lua_State *L);
+
+/**
+ * Raises a Lua error if the value is not a duplicate_cache() object.
+ */
+DuplicateCache &
+CheckLuaDuplicateCache(lua_State *L, int idx);
@@ -5,7 +5,13 @@
 #include "LMail.hxx"
 #include "MutableMail.hxx"
 #include "LAction.hxx"
+#include "LPatternSet.hxx"
+#include "LDuplicateCache.hxx"
+#include "LCgroup.hxx"
+#include "Instance.hxx"
+#include "DuplicateCache.hxx"
 #include "Action.hxx"
+#include "HeaderIndex.hxx"
 #include "lua/AutoCloseList.hxx"
 #include "lua/CheckArg.hxx"
 #include "lua/Class.hxx"
@@ -13,17 +19,25 @@
 #include "lua/FenvCache.hxx"
 #include "lua/ForEach.hxx"
 #include "lua/StringView.hxx"
-#include "lua/io/CgroupInfo.hxx"
+#include "lua/Resume.hxx"
 #include "lua/net/SocketAddress.hxx"
 #include "net/linux/PeerAuth.hxx"
 #include "uri/EmailAddress.hxx"
+#include "util/CharRange.hxx"
+#include "util/PatternSet.hxx"
 #include "util/StringAPI.hxx"
 #include "util/StringCompare.hxx"
-#include "util/StringVerify.hxx"
 #include "io/Beneath.hxx"
 #include "io/FileAt.hxx"
 #include "io/Open.hxx"
 #include "io/UniqueFileDescriptor.hxx"
+#include "config.h"
+
+#ifdef HAVE_LIBSODIUM
+#include "BodyHasher.hxx"
+#include "Dkim.hxx"
+#include "LDkim.hxx"
+#endif
 
 extern "C" {
 #include <lauxlib.h>
@@ -31,17 +45,45 @@ extern "C" {
 
 #include <fmt/format.h>
 
+#include <algorithm> // for std::find()
 #include <cmath> // for std::isnormal()
+#include <ctime>
+#include <optional>
+#include <vector>
 
 #include <sys/socket.h>
 #include <string.h>
 
 using std::string_view_literals::operator""sv;
 
-class IncomingMail : public MutableMail {
+class IncomingMail : public MutableMail, ResolverWaiter {
 	Lua::AutoCloseList *auto_close;
 
-	const SocketPeerAuth &peer_auth;
+	/**
+	 * The credentials of a local client; nullptr for TCP
+	 * clients.
+	 */
+	const SocketPeerAuth *const peer_auth;
+
+	/**
+	 * The address of a TCP client; null for local clients.
+	 */
+	const SocketAddress remote_address;
+
+	Instance &instance;
+
+	LuaMailResumer *const resumer;
+
+	/**
+	 * The coroutine which is suspended in Resolve().
+	 */
+	lua_State *resolve_thread = nullptr;
+
+	/**
+	 * The index of the message's header block; it is built on
+	 * first access by GetHeaderIndex().
+	 */
+	std::optional<HeaderIndex> header_index;
 
 public:
 	/**
@@ -53,10 +95,14 @@ public:
 	unsigned n_headers = 0;
 
 	IncomingMail(lua_State *L, Lua::AutoCloseList &_auto_close,
-		     MutableMail &&src, const SocketPeerAuth &_peer_auth)
+		     MutableMail &&src, const SocketPeerAuth *_peer_auth,
+		     SocketAddress _remote_address,
+		     Instance &_instance, LuaMailResumer *_resumer)
 		:MutableMail(std::move(src)),
 		 auto_close(&_auto_close),
-		 peer_auth(_peer_auth)
+		 peer_auth(_peer_auth),
+		 remote_address(_remote_address),
+		 instance(_instance), resumer(_resumer)
 	{
 		auto_close->Add(L, Lua::RelativeStackIndex{-1});
 
@@ -68,6 +114,10 @@ public:
 		return auto_close == nullptr;
 	}
 
+	EventLoop &GetEventLoop() const noexcept {
+		return instance.GetEventLoop();
+	}
+
 	/**
 	 * Raise a Lua error if this object is stale.
 	 */
@@ -78,52 +128,67 @@ public:
 
 	int Close(lua_State *) {
 		auto_close = nullptr;
+
+		/* cancel a pending Resolve() call */
+		if (ResolverWaiter::is_linked())
+			ResolverWaiter::unlink();
+		resolve_thread = nullptr;
+
+		header_index.reset();
 		Free();
 		return 0;
 	}
 
+	const HeaderIndex &GetHeaderIndex() noexcept {
+		if (!header_index)
+			header_index.emplace(message);
+		return *header_index;
+	}
+
+	/**
+	 * Implementation of the Lua method resolve(); it suspends
+	 * the coroutine if the name is not in the cache.
+	 */
+	int Resolve(lua_State *L, std::string_view host);
+
 	int Index(lua_State *L);
 	int NewIndex(lua_State *L);
+
+private:
+	void Resume(lua_State *L, int narg) noexcept {
+		if (resumer != nullptr)
+			resumer->ResumeHandler(L, narg);
+		else
+			Lua::Resume(L, narg);
+	}
+
+	/* virtual methods from class ResolverWaiter */
+	void OnResolved(SocketAddress address) noexcept override;
+	void OnResolverError(std::string_view error) noexcept override;
 };
 
 static constexpr char lua_mail_class[] = "qrelay.mail";
 typedef Lua::Class<IncomingMail, lua_mail_class> LuaMail;
 
-/**
- * @see RFC2822 2.2
- */
-static constexpr bool
-IsValidHeaderNameChar(char ch) noexcept
-{
-	return ch >= 33 && ch <= 126 && ch != ':';
-}
-
 /**
  * Is this a valid header name according to RFC2822 2.2?
  */
-static constexpr bool
+static bool
 IsValidHeaderName(std::string_view s) noexcept
 {
-	return CheckCharsNonEmpty(s, IsValidHeaderNameChar);
+	return !s.empty() && CheckCharRange(s, 33, 126, ':');
 }
 
 /**
+ * Is this a valid header value according to RFC2822 2.2?
+ *
  * Note that this is more strict than RFC2822 2.2; only printable
  * characters are allowed.
  */
-static constexpr bool
-IsValidHeaderValueChar(char ch) noexcept
-{
-	return ch >= ' ' && ch <= 126;
-}
-
-/**
- * Is this a valid header value according to RFC2822 2.2?
- */
 static bool
 IsValidHeaderValue(std::string_view s) noexcept
 {
-	return CheckChars(s, IsValidHeaderValueChar);
+	return CheckCharRange(s, ' ', 126);
 }
 
 static int
@@ -151,6 +216,246 @@ InsertHeader(lua_State *L)
 	return 0;
 }
 
+static void
+PushHeaderValue(lua_State *L, std::string_view value)
+{
+	if (IsFoldedHeaderValue(value))
+		Lua::Push(L, std::string_view{UnfoldHeaderValue(value)});
+	else
+		Lua::Push(L, value);
+}
+
+static int
+HeaderList(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, 1);
+	mail.CheckStale(L);
+
+	const std::string_view name = Lua::CheckStringView(L, 2);
+
+	lua_newtable(L);
+
+	lua_Integer i = 1;
+	mail.GetHeaderIndex().ForEach(name, [L, &i](const auto &field){
+		PushHeaderValue(L, field.value);
+		lua_rawseti(L, -2, i++);
+	});
+
+	return 1;
+}
+
+/**
+ * The "__index" method of the table returned by "m.headers"; the
+ * mail object is the first upvalue.
+ */
+static int
+HeaderLookup(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, lua_upvalueindex(1));
+	mail.CheckStale(L);
+
+	if (lua_type(L, 2) != LUA_TSTRING)
+		return 0;
+
+	const auto *field = mail.GetHeaderIndex().Find(Lua::ToStringView(L, 2));
+	if (field == nullptr)
+		return 0;
+
+	PushHeaderValue(L, field->value);
+
+	/* cache the value in the table */
+	lua_pushvalue(L, 2);
+	lua_pushvalue(L, -2);
+	lua_rawset(L, 1);
+
+	return 1;
+}
+
+/**
+ * Push a new (empty) table whose "__index" method looks up header
+ * values in the mail object at the specified stack index.
+ */
+static void
+NewHeaderTable(lua_State *L, int mail_idx)
+{
+	lua_newtable(L);
+
+	lua_newtable(L);
+	lua_pushvalue(L, mail_idx);
+	lua_pushcclosure(L, HeaderLookup, 1);
+	lua_setfield(L, -2, "__index");
+
+	lua_setmetatable(L, -2);
+}
+
+/**
+ * Search the message (headers and body, but not the headers
+ * inserted by insert_header()) for the patterns of a pattern_set()
+ * and return the first one found (or nil).
+ */
+static int
+Match(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, 1);
+	mail.CheckStale(L);
+
+	const auto &set = CheckLuaPatternSet(L, 2);
+
+	const auto i = set.Find(mail.message);
+	if (i == PatternSet::npos)
+		return 0;
+
+	Lua::Push(L, set.GetPattern(i));
+	return 1;
+}
+
+#ifdef HAVE_LIBSODIUM
+
+/**
+ * Check whether a submission with the same body and envelope was
+ * accepted recently.  If not, the submission will be added to the
+ * cache once it has been accepted.
+ */
+static int
+IsDuplicate(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, 1);
+	mail.CheckStale(L);
+
+	auto &cache = CheckLuaDuplicateCache(L, 2);
+
+	if (!mail.body_hash)
+		return luaL_error(L, "Listener option `body_hash` is not enabled");
+
+	const auto key = HashEnvelope(*mail.body_hash, mail.GetHeaderIndex(),
+				      mail.sender, mail.recipients);
+	/* use the same clock as QmqpRelayConnection::Finish() which
+	   inserts the key */
+	if (cache.Contains(key, mail.GetEventLoop().SteadyNow())) {
+		lua_pushboolean(L, true);
+		return 1;
+	}
+
+	mail.duplicate_cache = &cache;
+	mail.duplicate_key = key;
+
+	lua_pushboolean(L, false);
+	return 1;
+}
+
+/**
+ * The header fields signed by dkim_sign() by default.
+ */
+static constexpr std::string_view default_dkim_headers[] = {
+	"From", "Reply-To", "Subject", "Date", "To", "Cc",
+	"Message-ID", "In-Reply-To", "References",
+	"MIME-Version", "Content-Type", "Content-Transfer-Encoding",
+};
+
+/**
+ * Collect the "headers" option of dkim_sign().  The string_views
+ * point into Lua strings referenced by the options table.
+ */
+static std::vector<std::string_view>
+CollectDkimOptions(lua_State *L, Lua::AnyStackIndex auto idx)
+{
+	std::vector<std::string_view> headers;
+
+	Lua::ForEach(L, idx, [L, &headers](auto key_idx, auto value_idx){
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) != LUA_TSTRING)
+			throw std::runtime_error("Option key is not a string");
+
+		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
+		if (key == "headers"sv) {
+			const int value = Lua::GetStackIndex(value_idx);
+			if (!lua_istable(L, value))
+				throw std::runtime_error("`headers` must be a table");
+
+			const std::size_t n = lua_objlen(L, value);
+			for (std::size_t i = 1; i <= n; ++i) {
+				lua_rawgeti(L, value, i);
+				if (lua_type(L, -1) != LUA_TSTRING)
+					throw std::runtime_error("Header name is not a string");
+
+				headers.push_back(Lua::ToStringView(L, -1));
+				lua_pop(L, 1);
+			}
+		} else
+			throw std::runtime_error("Unknown option");
+	});
+
+	return headers;
+}
+
+/**
+ * Add a "DKIM-Signature" header (like insert_header()) signing the
+ * message with the specified dkim_key().
+ */
+static int
+DkimSignMail(lua_State *L)
+try {
+	const int top = lua_gettop(L);
+	if (top < 2 || top > 3)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, 1);
+	mail.CheckStale(L);
+
+	const auto &key = CheckLuaDkimKey(L, 2);
+
+	std::vector<std::string_view> signed_names;
+	if (top >= 3) {
+		if (!lua_istable(L, 3))
+			return luaL_argerror(L, 3, "table expected");
+
+		signed_names = CollectDkimOptions(L, Lua::StackIndex{3});
+	}
+
+	if (signed_names.empty())
+		signed_names.assign(std::begin(default_dkim_headers),
+				    std::end(default_dkim_headers));
+
+	if (mail.n_headers >= IncomingMail::MAX_HEADERS)
+		return luaL_error(L, "Too many headers");
+
+	/* the header fields in the order they will be sent: first
+	   those inserted by insert_header(), then the message's
+	   own */
+	std::vector<HeaderIndex::Field> fields;
+	for (const auto &i : mail.headers) {
+		const HeaderIndex inserted{i};
+		const auto f = inserted.GetFields();
+		fields.insert(fields.end(), f.begin(), f.end());
+	}
+
+	const auto message_fields = mail.GetHeaderIndex().GetFields();
+	fields.insert(fields.end(), message_fields.begin(), message_fields.end());
+
+	const auto value = DkimSign(key, fields, signed_names,
+				    FindMessageBody(mail.message),
+				    std::time(nullptr));
+
+	++mail.n_headers;
+	mail.InsertHeader("DKIM-Signature"sv, value);
+	return 0;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+#endif // HAVE_LIBSODIUM
+
 static int
 NewConnectAction(lua_State *L)
 {
@@ -215,6 +520,22 @@ CollectExecEnv(Action &action, lua_State *L, Lua::AnyStackIndex auto idx)
 	});
 }
 
+/**
+ * Check the value of a "timeout" option (in seconds).
+ */
+static Event::Duration
+CheckTimeoutOption(lua_State *L, int idx)
+{
+	if (!lua_isnumber(L, idx))
+		luaL_error(L, "Timeout is not a number");
+
+	const auto seconds = lua_tonumber(L, idx);
+	if (!std::isnormal(seconds) || seconds <= 0 || seconds > 3600)
+		luaL_error(L, "Bad timeout value");
+
+	return std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{seconds});
+}
+
 /**
  * Collect parameters from the "options" table passed as the last
  * parameter to exec() / exec_raw().
@@ -229,16 +550,9 @@ CollectExecOptions(Action &action, lua_State *L, Lua::AnyStackIndex auto idx)
 		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
 		if (key == "env"sv)
 			CollectExecEnv(action, L, value_idx);
-		else if (key == "timeout"sv) {
-			if (!lua_isnumber(L, Lua::GetStackIndex(value_idx)))
-				luaL_error(L, "Timeout is not a number");
-
-			const auto seconds = lua_tonumber(L, Lua::GetStackIndex(value_idx));
-			if (!std::isnormal(seconds) || seconds <= 0 || seconds > 3600)
-				luaL_error(L, "Bad timeout value");
-
-			action.timeout = std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{seconds});
-		} else
+		else if (key == "timeout"sv)
+			action.timeout = CheckTimeoutOption(L, Lua::GetStackIndex(value_idx));
+		else
 			luaL_error(L, "Unknown option");
 	});
 }
@@ -294,13 +608,278 @@ NewExecRawAction(lua_State *L)
 	return 1;
 }
 
+/**
+ * Create an action which performs several other actions
+ * concurrently.  The parameter is a table containing the primary
+ * action followed by the secondaries, and optionally a "timeout" for
+ * the secondaries.
+ */
+static int
+NewFanoutAction(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	luaL_checktype(L, 2, LUA_TTABLE);
+
+	const std::size_t n = lua_objlen(L, 2);
+	if (n < 2)
+		return luaL_argerror(L, 2, "Need a primary and at least one secondary action");
+
+	if (n > Action::MAX_FANOUT)
+		return luaL_argerror(L, 2, "Too many actions");
+
+	auto &action = *NewLuaAction(L);
+	action.type = Action::Type::FANOUT;
+	action.actions.reserve(n);
+
+	for (std::size_t i = 1; i <= n; ++i) {
+		lua_rawgeti(L, 2, i);
+
+		const auto *item = CheckLuaAction(L, -1);
+		if (item == nullptr)
+			return luaL_argerror(L, 2, "Not an action");
+
+		switch (item->type) {
+		case Action::Type::UNDEFINED:
+			return luaL_argerror(L, 2, "Undefined action");
+
+		case Action::Type::FANOUT:
+		case Action::Type::SPLIT:
+			return luaL_argerror(L, 2, "Fanout actions cannot be nested");
+
+		case Action::Type::DISCARD:
+		case Action::Type::REJECT:
+			if (i > 1)
+				return luaL_argerror(L, 2, "Secondary actions must relay the mail");
+			break;
+
+		case Action::Type::CONNECT:
+		case Action::Type::EXEC:
+		case Action::Type::EXEC_RAW:
+			break;
+		}
+
+		action.actions.push_back(*item);
+		lua_pop(L, 1);
+	}
+
+	Lua::ForEach(L, Lua::StackIndex{2}, [L, &action](auto key_idx, auto value_idx){
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) == LUA_TNUMBER)
+			/* an action (checked above) */
+			return;
+
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) != LUA_TSTRING)
+			luaL_error(L, "Option key is not a string");
+
+		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
+		if (key == "timeout"sv)
+			action.timeout = CheckTimeoutOption(L, Lua::GetStackIndex(value_idx));
+		else
+			luaL_error(L, "Unknown option");
+	});
+
+	return 1;
+}
+
+/**
+ * Find a recipient which has not yet been assigned to a group.
+ *
+ * @return the index or std::string_view::npos if not found
+ */
+[[gnu::pure]]
+static std::size_t
+FindUnroutedRecipient(const QmqpMail &mail, const std::vector<bool> &routed,
+		      std::string_view recipient) noexcept
+{
+	for (std::size_t i = 0; i < mail.recipients.size(); ++i)
+		if (!routed[i] && mail.recipients[i] == recipient)
+			return i;
+
+	return std::string_view::npos;
+}
+
+/**
+ * Create an action which splits the recipients into groups, each
+ * with its own action.  The parameter is a table of groups, each
+ * being a table with the fields "recipients" (an array of recipient
+ * addresses) and "action"; it may contain a "timeout" for the whole
+ * operation.
+ */
+static int
+NewSplitAction(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, 1);
+	mail.CheckStale(L);
+
+	luaL_checktype(L, 2, LUA_TTABLE);
+
+	const std::size_t n = lua_objlen(L, 2);
+	if (n == 0)
+		return luaL_argerror(L, 2, "No recipient groups");
+
+	if (n > Action::MAX_SPLIT)
+		return luaL_argerror(L, 2, "Too many recipient groups");
+
+	auto &action = *NewLuaAction(L);
+	action.type = Action::Type::SPLIT;
+	action.mail_id = mail.id;
+	action.actions.reserve(n);
+
+	std::vector<bool> routed(mail.recipients.size());
+
+	for (std::size_t i = 1; i <= n; ++i) {
+		lua_rawgeti(L, 2, i);
+		if (!lua_istable(L, -1))
+			return luaL_argerror(L, 2, "Recipient group is not a table");
+
+		lua_getfield(L, -1, "action");
+		const auto *item = CheckLuaAction(L, -1);
+		if (item == nullptr)
+			return luaL_argerror(L, 2, "Recipient group without action");
+
+		switch (item->type) {
+		case Action::Type::UNDEFINED:
+			return luaL_argerror(L, 2, "Undefined action");
+
+		case Action::Type::FANOUT:
+		case Action::Type::SPLIT:
+			return luaL_argerror(L, 2, "Split actions cannot be nested");
+
+		case Action::Type::DISCARD:
+		case Action::Type::REJECT:
+		case Action::Type::CONNECT:
+		case Action::Type::EXEC:
+		case Action::Type::EXEC_RAW:
+			break;
+		}
+
+		auto &group = action.actions.emplace_back(*item);
+		lua_pop(L, 1);
+
+		lua_getfield(L, -1, "recipients");
+		if (!lua_istable(L, -1))
+			return luaL_argerror(L, 2, "Recipient group without recipients");
+
+		const std::size_t n_recipients = lua_objlen(L, -1);
+		if (n_recipients == 0)
+			return luaL_argerror(L, 2, "Empty recipient group");
+
+		group.recipients.reserve(n_recipients);
+
+		for (std::size_t j = 1; j <= n_recipients; ++j) {
+			lua_rawgeti(L, -1, j);
+			if (lua_type(L, -1) != LUA_TSTRING)
+				return luaL_argerror(L, 2, "Recipient is not a string");
+
+			const auto index = FindUnroutedRecipient(mail, routed,
+								 Lua::ToStringView(L, -1));
+			if (index == std::string_view::npos)
+				return luaL_error(L, "Not a recipient or in more than one group: %s",
+						  lua_tostring(L, -1));
+
+			routed[index] = true;
+			group.recipients.push_back(index);
+			lua_pop(L, 1);
+		}
+
+		/* pop the recipient list and the group */
+		lua_pop(L, 2);
+	}
+
+	if (std::find(routed.begin(), routed.end(), false) != routed.end())
+		return luaL_argerror(L, 2, "Not all recipients are in a group");
+
+	Lua::ForEach(L, Lua::StackIndex{2}, [L, &action](auto key_idx, auto value_idx){
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) == LUA_TNUMBER)
+			/* a recipient group (checked above) */
+			return;
+
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) != LUA_TSTRING)
+			luaL_error(L, "Option key is not a string");
+
+		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
+		if (key == "timeout"sv)
+			action.timeout = CheckTimeoutOption(L, Lua::GetStackIndex(value_idx));
+		else
+			luaL_error(L, "Unknown option");
+	});
+
+	return 1;
+}
+
+inline int
+IncomingMail::Resolve(lua_State *L, std::string_view host)
+{
+	if (ResolverWaiter::is_linked())
+		return luaL_error(L, "Already resolving");
+
+	auto *entry = instance.GetResolverCache().Get(host, *this);
+	if (entry == nullptr) {
+		/* not cached; OnResolved() or OnResolverError() will
+		   resume the coroutine */
+		resolve_thread = L;
+		return lua_yield(L, 0);
+	}
+
+	if (!entry->HasAddress()) {
+		lua_pushnil(L);
+		Lua::Push(L, std::string_view{entry->error});
+		return 2;
+	}
+
+	Lua::NewSocketAddress(L, entry->NextAddress());
+	return 1;
+}
+
+void
+IncomingMail::OnResolved(SocketAddress address) noexcept
+{
+	const auto L = std::exchange(resolve_thread, nullptr);
+	Lua::NewSocketAddress(L, address);
+	Resume(L, 1);
+}
+
+void
+IncomingMail::OnResolverError(std::string_view error) noexcept
+{
+	const auto L = std::exchange(resolve_thread, nullptr);
+	lua_pushnil(L);
+	Lua::Push(L, error);
+	Resume(L, 2);
+}
+
+static int
+ResolveHost(lua_State *L)
+{
+	if (lua_gettop(L) != 2)
+		return luaL_error(L, "Invalid parameters");
+
+	auto &mail = (IncomingMail &)CastLuaMail(L, 1);
+	mail.CheckStale(L);
+
+	return mail.Resolve(L, Lua::CheckStringView(L, 2));
+}
+
 static constexpr struct luaL_Reg mail_methods [] = {
 	{"insert_header", InsertHeader},
+	{"header_list", HeaderList},
+	{"match", Match},
+	{"resolve", ResolveHost},
+#ifdef HAVE_LIBSODIUM
+	{"is_duplicate", IsDuplicate},
+	{"dkim_sign", DkimSignMail},
+#endif
 	{"connect", NewConnectAction},
 	{"discard", NewDiscardAction},
 	{"reject", NewRejectAction},
 	{"exec", NewExecAction},
 	{"exec_raw", NewExecRawAction},
+	{"fanout", NewFanoutAction},
+	{"split", NewSplitAction},
 	{nullptr, nullptr}
 };
 
@@ -344,33 +923,60 @@ IncomingMail::Index(lua_State *L)
 		return 1;
 	} else if (StringIsEqual(name, "recipients")) {
 		PushArray(L, recipients);
+		return 1;
+	} else if (StringIsEqual(name, "headers")) {
+		NewHeaderTable(L, 1);
+
+		// copy a reference to the fenv (our cache)
+		Lua::SetFenvCache(L, 1, name_idx, Lua::RelativeStackIndex{-1});
+
+		return 1;
+	} else if (StringIsEqual(name, "body_hash")) {
+		if (!body_hash)
+			return 0;
+
+		const auto hex = FormatBodyHash(*body_hash);
+		Lua::Push(L, std::string_view{hex.data(), hex.size()});
+		return 1;
+	} else if (StringIsEqual(name, "remote_address")) {
+		if (remote_address.IsNull())
+			return 0;
+
+		Lua::NewSocketAddress(L, remote_address);
+
+		// copy a reference to the fenv (our cache)
+		Lua::SetFenvCache(L, 1, name_idx, Lua::RelativeStackIndex{-1});
+
 		return 1;
 	} else if (StringIsEqual(name, "pid")) {
-		if (!peer_auth.HaveCred())
+		if (peer_auth == nullptr || !peer_auth->HaveCred())
 			return 0;
 
-		Lua::Push(L, static_cast<lua_Integer>(peer_auth.GetPid()));
+		Lua::Push(L, static_cast<lua_Integer>(peer_auth->GetPid()));
 		return 1;
 	} else if (StringIsEqual(name, "uid")) {
-		if (!peer_auth.HaveCred())
+		if (peer_auth == nullptr || !peer_auth->HaveCred())
 			return 0;
 
-		Lua::Push(L, static_cast<lua_Integer>(peer_auth.GetUid()));
+		Lua::Push(L, static_cast<lua_Integer>(peer_auth->GetUid()));
 		return 1;
 	} else if (StringIsEqual(name, "gid")) {
-		if (!peer_auth.HaveCred())
+		if (peer_auth == nullptr || !peer_auth->HaveCred())
 			return 0;
 
-		Lua::Push(L, static_cast<lua_Integer>(peer_auth.GetGid()));
+		Lua::Push(L, static_cast<lua_Integer>(peer_auth->GetGid()));
 		return 1;
 	} else if (StringIsEqual(name, "cgroup")) {
+		if (peer_auth == nullptr)
+			return 0;
+
 		/* this call throws if the client process has already
 		   exited which will fail the script */
-		const auto path = peer_auth.GetCgroupPath();
+		const auto path = peer_auth->GetCgroupPath();
 		if (path.empty())
 			return 0;
 
-		Lua::NewCgroupInfo(L, *auto_close, path);
+		NewLuaCgroup(L, instance.GetCgroupCache().Get(path));
 
 		// copy a reference to the fenv (our cache)
 		Lua::SetFenvCache(L, 1, name_idx, Lua::RelativeStackIndex{-1});
@@ -429,9 +1035,16 @@ RegisterLuaMail(lua_State *L)
 MutableMail *
 NewLuaMail(lua_State *L,
 	   Lua::AutoCloseList &auto_close,
-	   MutableMail &&src, const SocketPeerAuth &peer_auth)
+	   MutableMail &&src, const SocketPeerAuth *peer_auth,
+	   SocketAddress remote_address,
+	   Instance &instance, LuaMailResumer *resumer)
 {
-	return LuaMail::New(L, L, auto_close, std::move(src), peer_auth);
+	static uint_least64_t last_id = 0;
+
+	auto *mail = LuaMail::New(L, L, auto_close, std::move(src), peer_auth,
+				  remote_address, instance, resumer);
+	mail->id = ++last_id;
+	return mail;
 }
 
 MutableMail &
@@ -439,3 +1052,12 @@ CastLuaMail(lua_State *L, int idx)
 {
 	return LuaMail::Cast(L, idx);
 }
+
+const MutableMail *
+CheckLuaMail(lua_State *L, int idx)
+{
+	const auto *mail = LuaMail::Check(L, idx);
+	if (mail != nullptr)
+		mail->CheckStale(L);
+	return mail;
+}
@@ -9,18 +9,46 @@
 struct lua_State;
 struct MutableMail;
 class SocketPeerAuth;
+class SocketAddress;
+class Instance;
 namespace Lua { class AutoCloseList; }
 
+/**
+ * Resumes the handler coroutine after a method of the mail object
+ * has yielded (e.g. m:resolve()).  The connection implements it to
+ * check how long the resumed handler runs.
+ */
+class LuaMailResumer {
+public:
+	virtual void ResumeHandler(lua_State *L, int narg) noexcept = 0;
+};
+
 void
 RegisterLuaMail(lua_State *L);
 
 /**
  * @param L the lua_State on whose stack the new object will be pushed
+ * @param peer_auth the credentials of a local client (or nullptr)
+ * @param remote_address the address of a TCP client (or a null
+ * address); must remain valid as long as the mail object
+ * @param resumer resumes the handler coroutine after it has yielded
+ * (or nullptr to call Lua::Resume() directly); must remain valid as
+ * long as the mail object
  */
 MutableMail *
 NewLuaMail(lua_State *L,
 	   Lua::AutoCloseList &auto_close,
-	   MutableMail &&src, const SocketPeerAuth &peer_auth);
+	   MutableMail &&src, const SocketPeerAuth *peer_auth,
+	   SocketAddress remote_address,
+	   Instance &instance, LuaMailResumer *resumer);
 
 MutableMail &
 CastLuaMail(lua_State *L, int idx);
+
+/**
+ * @return the mail object at the specified stack index or nullptr
+ * if the value is not a mail object (raises a Lua error if the mail
+ * object is stale)
+ */
+const MutableMail *
+CheckLuaMail(lua_State *L, int idx);
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LPatternSet.hxx"
+#include "util/PatternSet.hxx"
+#include "lib/fmt/RuntimeError.hxx"
+#include "lua/Class.hxx"
+#include "lua/Error.hxx"
+#include "lua/ForEach.hxx"
+#include "lua/StringView.hxx"
+#include "lua/Util.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+using std::string_view_literals::operator""sv;
+
+static constexpr char lua_pattern_set_class[] = "qrelay.pattern_set";
+typedef Lua::Class<PatternSet, lua_pattern_set_class> LuaPatternSet;
+
+/**
+ * Collect parameters from the "options" table passed as the last
+ * parameter to pattern_set().
+ */
+static bool
+CollectPatternSetOptions(lua_State *L, Lua::AnyStackIndex auto idx)
+{
+	bool ignore_case = false;
+
+	Lua::ForEach(L, idx, [L, &ignore_case](auto key_idx, auto value_idx){
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) != LUA_TSTRING)
+			throw std::runtime_error("Option key is not a string");
+
+		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
+		if (key == "ignore_case"sv) {
+			if (!lua_isboolean(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`ignore_case` must be a boolean");
+
+			ignore_case = lua_toboolean(L, Lua::GetStackIndex(value_idx));
+		} else
+			throw FmtRuntimeError("Unknown option `{}`", key);
+	});
+
+	return ignore_case;
+}
+
+static int
+l_pattern_set(lua_State *L)
+try {
+	const int top = lua_gettop(L);
+	if (top < 1 || top > 2)
+		return luaL_error(L, "Invalid parameter count");
+
+	if (!lua_istable(L, 1))
+		return luaL_argerror(L, 1, "table expected");
+
+	bool ignore_case = false;
+	if (top >= 2) {
+		if (!lua_istable(L, 2))
+			return luaL_argerror(L, 2, "table expected");
+
+		ignore_case = CollectPatternSetOptions(L, Lua::StackIndex{2});
+	}
+
+	/* the string_views point into Lua strings which are
+	   referenced by the table at index 1 */
+	std::vector<std::string_view> patterns;
+	const std::size_t n = lua_objlen(L, 1);
+	patterns.reserve(n);
+
+	for (std::size_t i = 1; i <= n; ++i) {
+		lua_rawgeti(L, 1, i);
+		if (lua_type(L, -1) != LUA_TSTRING)
+			throw std::runtime_error("Pattern is not a string");
+
+		patterns.push_back(Lua::ToStringView(L, -1));
+		lua_pop(L, 1);
+	}
+
+	LuaPatternSet::New(L, PatternSet{patterns, ignore_case});
+	return 1;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+void
+RegisterLuaPatternSet(lua_State *L)
+{
+	LuaPatternSet::Register(L);
+	lua_pop(L, 1);
+
+	Lua::SetGlobal(L, "pattern_set", l_pattern_set);
+}
+
+void
+UnregisterLuaPatternSet(lua_State *L)
+{
+	Lua::SetGlobal(L, "pattern_set", nullptr);
+}
+
+const PatternSet &
+CheckLuaPatternSet(lua_State *L, int idx)
+{
+	return LuaPatternSet::Cast(L, idx);
+}
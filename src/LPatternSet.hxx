@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+struct lua_State;
+class PatternSet;
+
+/**
+ * Register the "pattern_set" class and the global function
+ * pattern_set() which compiles a #PatternSet.
+ */
+void
+RegisterLuaPatternSet(lua_State *L);
+
+/**
+ * Remove the global function pattern_set(); pattern sets can only
+ * be compiled while the configuration is loaded.
+ */
+void
+UnregisterLuaPatternSet(lua_State *L);
+
+/**
+ * Raises a Lua error if the value is not a pattern_set() object.
+ */
+const PatternSet &
+CheckLuaPatternSet(lua_State *L, int idx);
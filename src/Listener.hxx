@@ -11,5 +11,5 @@
 
 using QmqpRelayListener =
 	TemplateServerSocket<QmqpRelayConnection,
-			     Instance &, std::size_t, Lua::ValuePtr,
+			     Instance &, ListenerConfig &, Lua::ValuePtr,
 			     RootLogger>;
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "QmqpReceiveLimits.hxx"
+#include "event/Chrono.hxx"
+#include "lua/ValuePtr.hxx"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Settings and statistics of one qmqp_listen() call (which may
+ * create more than one listener socket, e.g. with systemd socket
+ * activation).
+ */
+struct ListenerConfig {
+	/**
+	 * A human-readable name (the listener address) used for
+	 * metrics.
+	 */
+	std::string name;
+
+	std::size_t max_size;
+
+	/**
+	 * The listen() backlog of sockets created by qrelay.
+	 */
+	unsigned backlog = 64;
+
+	/**
+	 * Set SO_REUSEPORT on sockets created by qrelay, so several
+	 * processes can share the port and the kernel balances new
+	 * connections between them.
+	 */
+	bool reuse_port = false;
+
+	QmqpReceiveLimits receive_limits;
+
+	/**
+	 * The maximum time the Lua handler may run without yielding
+	 * back to the #EventLoop.  Zero means no limit.
+	 */
+	Event::Duration cpu_budget{};
+
+	/**
+	 * An optional Lua function which is called after the
+	 * announced request size has been received, before the
+	 * payload is received.
+	 */
+	Lua::ValuePtr on_connect;
+
+	/**
+	 * Calculate the #BodyHash of each mail while it is being
+	 * received?
+	 */
+	bool body_hash = false;
+
+	/**
+	 * The number of handler invocations aborted because they
+	 * exceeded #cpu_budget.
+	 */
+	uint_least64_t n_budget_exceeded = 0;
+
+	/**
+	 * The number of connections closed because the client did
+	 * not send its request in time, indexed by
+	 * #QmqpReceiveTimeout.
+	 */
+	std::array<uint_least64_t, N_QMQP_RECEIVE_TIMEOUTS> n_receive_timeouts{};
+
+	/**
+	 * The number of requests submitted in a memfd.
+	 */
+	uint_least64_t n_memfd_submissions = 0;
+};
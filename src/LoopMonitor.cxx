@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LoopMonitor.hxx"
+#include "Metrics.hxx"
+#include "event/Loop.hxx"
+#include "config.h"
+
+#ifdef HAVE_LIBSYSTEMD
+#include <systemd/sd-daemon.h>
+#endif
+
+#include <algorithm>
+
+#include <time.h>
+
+using std::string_view_literals::operator""sv;
+
+static std::chrono::nanoseconds
+GetThreadCpuTime() noexcept
+{
+	struct timespec ts;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) < 0)
+		return {};
+
+	return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+static constexpr double
+ToSeconds(Event::Duration d) noexcept
+{
+	return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+LoopMonitor::LoopMonitor(EventLoop &event_loop) noexcept
+	:timer(event_loop, BIND_THIS_METHOD(OnTimer)) {}
+
+void
+LoopMonitor::Start() noexcept
+{
+#ifdef HAVE_LIBSYSTEMD
+	if (uint64_t usec; sd_watchdog_enabled(true, &usec) > 0) {
+		watchdog_timeout = std::chrono::microseconds{usec};
+		next_watchdog_ping = Event::Clock::now();
+	}
+#endif
+
+	/* the EventLoop may not have been running before, therefore
+	   the first sample is meaningless */
+	skip_next_sample = true;
+	ScheduleSample();
+}
+
+inline void
+LoopMonitor::ScheduleSample() noexcept
+{
+	expected_wakeup = Event::Clock::now() + SAMPLE_INTERVAL;
+	timer.Schedule(SAMPLE_INTERVAL);
+}
+
+inline void
+LoopMonitor::StartWindow(Event::TimePoint now) noexcept
+{
+	window_start = now;
+	window_cpu_start = GetThreadCpuTime();
+	window_max_lag = window_total_lag = {};
+	window_samples = 0;
+}
+
+inline void
+LoopMonitor::FinishWindow(Event::TimePoint now) noexcept
+{
+	const auto wall = now - window_start;
+	const auto cpu = GetThreadCpuTime() - window_cpu_start;
+
+	max_lag = window_max_lag;
+	average_lag = window_total_lag / window_samples;
+	busy_ratio = wall.count() > 0
+		? std::min(ToSeconds(cpu) / ToSeconds(wall), 1.0)
+		: 0.0;
+
+#ifdef HAVE_LIBSYSTEMD
+	/* let "systemctl status" show the current figures; the
+	   watchdog timer runs in the same EventLoop and will be late
+	   by (at least) the same lag */
+	sd_notifyf(0, "STATUS=loop lag %.1f ms, busy %.0f%%",
+		   ToSeconds(max_lag) * 1000, busy_ratio * 100);
+#endif
+}
+
+#ifdef HAVE_LIBSYSTEMD
+
+inline void
+LoopMonitor::PingWatchdog(Event::TimePoint now) noexcept
+{
+	if (watchdog_timeout.count() == 0 || now < next_watchdog_ping)
+		return;
+
+	/* like Systemd::Watchdog, notify twice per timeout period */
+	sd_notify(0, "WATCHDOG=1");
+	next_watchdog_ping = now + watchdog_timeout / 2;
+}
+
+#endif
+
+void
+LoopMonitor::OnTimer() noexcept
+{
+	const auto now = Event::Clock::now();
+
+#ifdef HAVE_LIBSYSTEMD
+	PingWatchdog(now);
+#endif
+
+	if (skip_next_sample) {
+		skip_next_sample = false;
+		StartWindow(now);
+		ScheduleSample();
+		return;
+	}
+
+	const auto lag = std::max(now - expected_wakeup, Event::Duration{});
+	window_max_lag = std::max(window_max_lag, lag);
+	window_total_lag += lag;
+
+	if (++window_samples >= SAMPLES_PER_WINDOW) {
+		FinishWindow(now);
+		StartWindow(now);
+	}
+
+	ScheduleSample();
+}
+
+void
+LoopMonitor::WriteMetrics(std::string &out) const noexcept
+{
+	WriteMetric(out, "qrelay_event_loop_lag_max_seconds"sv, "gauge"sv,
+		    "Maximum event loop timer lag during the last second"sv,
+		    ToSeconds(max_lag));
+	WriteMetric(out, "qrelay_event_loop_lag_average_seconds"sv, "gauge"sv,
+		    "Average event loop timer lag during the last second"sv,
+		    ToSeconds(average_lag));
+	WriteMetric(out, "qrelay_event_loop_busy_ratio"sv, "gauge"sv,
+		    "Share of the last second the event loop thread spent on the CPU"sv,
+		    busy_ratio);
+	WriteMetric(out, "qrelay_slow_callbacks_total"sv, "counter"sv,
+		    "Number of callbacks which exceeded slow_callback_threshold"sv,
+		    n_slow_callbacks);
+}
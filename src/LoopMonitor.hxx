@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/FineTimerEvent.hxx"
+#include "event/Chrono.hxx"
+#include "config.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * Measures how well the #EventLoop keeps up with its work: the lag
+ * of a periodic timer (scheduled wakeup vs. actual wakeup) and the
+ * share of wall-clock time this thread spent on the CPU ("busy
+ * ratio").  Both are aggregated over one-second windows.
+ *
+ * Since all connections share one #EventLoop, a high lag means
+ * that some callback (e.g. a slow Lua handler) delayed all other
+ * connections.
+ *
+ * With systemd, this class also sends the watchdog keep-alive
+ * notifications (replacing #Systemd::Watchdog), from the same timer
+ * which measures the lag: if the #EventLoop stalls, both stop, and
+ * systemd restarts qrelay once the stall exceeds "WatchdogSec".
+ */
+class LoopMonitor {
+	static constexpr Event::Duration SAMPLE_INTERVAL = std::chrono::milliseconds{100};
+	static constexpr unsigned SAMPLES_PER_WINDOW = 10;
+
+	FineTimerEvent timer;
+
+	/**
+	 * When we expect #timer to fire.
+	 */
+	Event::TimePoint expected_wakeup;
+
+	Event::TimePoint window_start;
+	std::chrono::nanoseconds window_cpu_start;
+
+	Event::Duration window_max_lag, window_total_lag;
+	unsigned window_samples;
+
+	/**
+	 * Callbacks which run longer than this are considered
+	 * "slow".
+	 */
+	Event::Duration slow_threshold = std::chrono::milliseconds{100};
+
+	/**
+	 * If true, then the next timer sample is not accounted,
+	 * because the #EventLoop was not running before it.
+	 */
+	bool skip_next_sample;
+
+	/* values from the last completed window */
+	Event::Duration max_lag{}, average_lag{};
+	double busy_ratio = 0;
+
+	uint_least64_t n_slow_callbacks = 0;
+
+#ifdef HAVE_LIBSYSTEMD
+	/**
+	 * The systemd watchdog timeout; zero if the watchdog is
+	 * disabled.
+	 */
+	Event::Duration watchdog_timeout{};
+
+	/**
+	 * When the next watchdog keep-alive is due.
+	 */
+	Event::TimePoint next_watchdog_ping;
+#endif
+
+public:
+	explicit LoopMonitor(EventLoop &event_loop) noexcept;
+
+	void Start() noexcept;
+
+	void Stop() noexcept {
+		timer.Cancel();
+	}
+
+	void SetSlowThreshold(Event::Duration _threshold) noexcept {
+		slow_threshold = _threshold;
+	}
+
+	/**
+	 * Check whether a callback which ran for the specified
+	 * duration was "slow" and account it.
+	 *
+	 * @return true if the callback was slow and the caller
+	 * should log a warning
+	 */
+	bool CheckCallback(Event::Duration duration) noexcept {
+		if (duration < slow_threshold)
+			return false;
+
+		++n_slow_callbacks;
+		return true;
+	}
+
+	/**
+	 * Append the metrics in the Prometheus text format.
+	 */
+	void WriteMetrics(std::string &out) const noexcept;
+
+private:
+	void ScheduleSample() noexcept;
+	void StartWindow(Event::TimePoint now) noexcept;
+	void FinishWindow(Event::TimePoint now) noexcept;
+
+#ifdef HAVE_LIBSYSTEMD
+	void PingWatchdog(Event::TimePoint now) noexcept;
+#endif
+
+	void OnTimer() noexcept;
+};
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LuaBytecodeCache.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "io/Open.hxx"
+#include "lua/Error.hxx"
+#include "util/ScopeExit.hxx"
+
+extern "C" {
+#include <lauxlib.h>
+}
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using std::string_view_literals::operator""sv;
+
+namespace {
+
+/**
+ * The header of each cache file.  It repeats the key (which is also
+ * the file name) so a renamed or truncated file is never loaded.
+ */
+struct BytecodeHeader {
+	static constexpr std::array<char, 8> MAGIC{'q', 'r', 'l', 'y', 'l', 'u', 'a', '1'};
+
+	std::array<char, 8> magic;
+	uint64_t source_size;
+	uint64_t hash[2];
+};
+
+} // anonymous namespace
+
+__extension__ using uint128_t = unsigned __int128;
+
+/**
+ * FNV-1a with 128 bits; collisions are practically impossible, and
+ * it is much cheaper than compiling the source.
+ */
+[[gnu::pure]]
+static uint128_t
+Hash(std::string_view path, std::string_view source) noexcept
+{
+	constexpr uint128_t prime =
+		(static_cast<uint128_t>(0x1000000) << 64) | 0x13b;
+
+	uint128_t h =
+		(static_cast<uint128_t>(0x6c62272e07bb0142ULL) << 64) |
+		0x62b821756295c58dULL;
+
+	const auto Update = [&h, prime](std::string_view s){
+		for (const char ch : s) {
+			h ^= static_cast<unsigned char>(ch);
+			h *= prime;
+		}
+	};
+
+	/* the path is part of the key because it is compiled into
+	   the bytecode (for error messages) */
+	Update(path);
+	Update({"", 1});
+	Update(source);
+	return h;
+}
+
+static std::string
+ReadFile(int directory_fd, const char *path)
+{
+	const int fd = openat(directory_fd, path, O_RDONLY|O_CLOEXEC);
+	if (fd < 0)
+		throw FmtErrno("Failed to open {}", path);
+
+	AtScopeExit(fd) { close(fd); };
+
+	std::string result;
+	std::array<char, 65536> buffer;
+
+	while (true) {
+		const auto nbytes = read(fd, buffer.data(), buffer.size());
+		if (nbytes < 0)
+			throw FmtErrno("Failed to read {}", path);
+
+		if (nbytes == 0)
+			break;
+
+		result.append(buffer.data(), static_cast<std::size_t>(nbytes));
+	}
+
+	return result;
+}
+
+LuaBytecodeCache::LuaBytecodeCache(const char *path)
+	:directory(OpenPath(path, O_DIRECTORY))
+{
+}
+
+void
+LuaBytecodeCache::LoadFile(lua_State *L, const char *path)
+{
+	const auto source = ReadFile(AT_FDCWD, path);
+	const auto chunkname = fmt::format("@{}"sv, path);
+
+	const auto hash = Hash(path, source);
+	const BytecodeHeader header{
+		.magic = BytecodeHeader::MAGIC,
+		.source_size = source.size(),
+		.hash = {
+			static_cast<uint64_t>(hash >> 64),
+			static_cast<uint64_t>(hash),
+		},
+	};
+
+	const auto name = fmt::format("{:016x}{:016x}.luac"sv,
+				      header.hash[0], header.hash[1]);
+
+	try {
+		const auto cached = ReadFile(directory.Get(), name.c_str());
+		if (cached.size() > sizeof(header) &&
+		    std::memcmp(cached.data(), &header, sizeof(header)) == 0) {
+			if (luaL_loadbuffer(L, cached.data() + sizeof(header),
+					    cached.size() - sizeof(header),
+					    chunkname.c_str()) == 0) {
+				++hits;
+				return;
+			}
+
+			/* bytecode from a different LuaJIT version:
+			   discard the error and compile the source
+			   again */
+			lua_pop(L, 1);
+		}
+	} catch (...) {
+		/* not cached */
+	}
+
+	++misses;
+
+	if (luaL_loadbuffer(L, source.data(), source.size(),
+			    chunkname.c_str()) != 0)
+		throw Lua::PopError(L);
+
+	std::string bytecode;
+	lua_dump(L, [](lua_State *, const void *p, std::size_t size, void *ud){
+		static_cast<std::string *>(ud)->append(static_cast<const char *>(p), size);
+		return 0;
+	}, &bytecode);
+
+	Store(name.c_str(), &header, sizeof(header),
+	      bytecode.data(), bytecode.size());
+}
+
+void
+LuaBytecodeCache::Store(const char *name, const void *header,
+			std::size_t header_size,
+			const void *bytecode, std::size_t bytecode_size) noexcept
+{
+	/* write to a temporary file and rename it, so readers (which
+	   may be another qrelay process) never see a partial file */
+	const auto tmp = fmt::format("{}.{}.tmp"sv, name, getpid());
+
+	const int fd = openat(directory.Get(), tmp.c_str(),
+			      O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC, 0600);
+	if (fd < 0) {
+		++write_errors;
+		return;
+	}
+
+	const bool success =
+		write(fd, header, header_size) == ssize_t(header_size) &&
+		write(fd, bytecode, bytecode_size) == ssize_t(bytecode_size);
+	close(fd);
+
+	if (!success ||
+	    renameat(directory.Get(), tmp.c_str(),
+		     directory.Get(), name) < 0) {
+		unlinkat(directory.Get(), tmp.c_str(), 0);
+		++write_errors;
+	}
+}
+
+/**
+ * An entry for "package.loaders" which looks up the module in
+ * "package.path" and loads it with LuaBytecodeCache::LoadFile().
+ */
+static int
+l_searcher(lua_State *L)
+try {
+	auto &cache = *(LuaBytecodeCache *)lua_touserdata(L, lua_upvalueindex(1));
+	luaL_checkstring(L, 1);
+
+	lua_getglobal(L, "package");
+	lua_getfield(L, -1, "searchpath");
+	lua_pushvalue(L, 1);
+	lua_getfield(L, -3, "path");
+	lua_call(L, 2, 2);
+
+	if (lua_isnil(L, -2))
+		/* not found; return the error message which lists
+		   all paths that were tried */
+		return 1;
+
+	const std::string path = lua_tostring(L, -2);
+	cache.LoadFile(L, path.c_str());
+	return 1;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
+void
+LuaBytecodeCache::Register(lua_State *L) noexcept
+{
+	lua_getglobal(L, "package");
+	lua_getfield(L, -1, "loaders");
+
+	if (lua_istable(L, -1)) {
+		/* insert before the standard Lua file searcher (index
+		   2, right after "package.preload") */
+		for (int i = lua_objlen(L, -1); i >= 2; --i) {
+			lua_rawgeti(L, -1, i);
+			lua_rawseti(L, -2, i + 1);
+		}
+
+		lua_pushlightuserdata(L, this);
+		lua_pushcclosure(L, l_searcher, 1);
+		lua_rawseti(L, -2, 2);
+	}
+
+	lua_pop(L, 2);
+}
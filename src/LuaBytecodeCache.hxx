@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "io/UniqueFileDescriptor.hxx"
+
+#include <cstddef>
+
+struct lua_State;
+
+/**
+ * A directory containing compiled Lua bytecode of the configuration
+ * file and the modules loaded with require().  Each entry is keyed
+ * by a hash of the source file's path and contents; a modified file
+ * is simply compiled again (and the old entry becomes garbage).
+ *
+ * Bytecode is not verified by the Lua VM, so the directory must not
+ * be writable by anybody else.
+ */
+class LuaBytecodeCache {
+	UniqueFileDescriptor directory;
+
+	std::size_t hits = 0, misses = 0, write_errors = 0;
+
+public:
+	/**
+	 * Throws if the directory cannot be opened.
+	 */
+	explicit LuaBytecodeCache(const char *path);
+
+	LuaBytecodeCache(const LuaBytecodeCache &) = delete;
+	LuaBytecodeCache &operator=(const LuaBytecodeCache &) = delete;
+
+	std::size_t GetHits() const noexcept {
+		return hits;
+	}
+
+	std::size_t GetMisses() const noexcept {
+		return misses;
+	}
+
+	std::size_t GetWriteErrors() const noexcept {
+		return write_errors;
+	}
+
+	/**
+	 * Load a Lua source file (from the cache if possible) and push
+	 * the compiled chunk on the Lua stack.  Throws on error.
+	 */
+	void LoadFile(lua_State *L, const char *path);
+
+	/**
+	 * Install a module searcher which makes require() load Lua
+	 * modules through this cache.  This object must live as long
+	 * as the #lua_State.
+	 */
+	void Register(lua_State *L) noexcept;
+
+private:
+	void Store(const char *name, const void *header,
+		   std::size_t header_size,
+		   const void *bytecode, std::size_t bytecode_size) noexcept;
+};
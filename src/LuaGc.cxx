@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LuaGc.hxx"
+#include "Metrics.hxx"
+
+extern "C" {
+#include <lua.h>
+}
+
+#include <algorithm>
+
+using std::string_view_literals::operator""sv;
+
+static constexpr double
+ToSeconds(Event::Duration d) noexcept
+{
+	return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+LuaGcScheduler::LuaGcScheduler(EventLoop &event_loop, lua_State *_L) noexcept
+	:L(_L),
+	 idle_event(event_loop, BIND_THIS_METHOD(OnIdle)),
+	 timer(event_loop, BIND_THIS_METHOD(OnTimer)) {}
+
+inline std::size_t
+LuaGcScheduler::GetHeapKB() const noexcept
+{
+	return static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNT, 0));
+}
+
+void
+LuaGcScheduler::Start() noexcept
+{
+	/* the automatic collector remains as a safety net for code
+	   which allocates a lot without ever returning to the
+	   #EventLoop (e.g. a long handler or the "reload" coroutine);
+	   with this pause, it starts a new cycle only long after our
+	   idle and hot-path thresholds would have */
+	lua_gc(L, LUA_GCSETPAUSE, SAFETY_NET_PAUSE);
+
+	/* get rid of the garbage left behind by loading the
+	   configuration */
+	FullCollect();
+
+	timer.Schedule(std::chrono::seconds{1});
+}
+
+void
+LuaGcScheduler::Stop() noexcept
+{
+	idle_event.Cancel();
+	timer.Cancel();
+}
+
+bool
+LuaGcScheduler::Step() noexcept
+{
+	/* the more was allocated since the last step, the more work
+	   this step needs to do to keep up */
+	const std::size_t heap_kb = GetHeapKB();
+	const std::size_t allocated_kb = heap_kb > last_heap_kb
+		? heap_kb - last_heap_kb
+		: 0;
+	const std::size_t step_kb = std::clamp(allocated_kb * 2,
+					       MIN_STEP_KB, MAX_STEP_KB);
+
+	const auto start = Event::Clock::now();
+	const bool finished = lua_gc(L, LUA_GCSTEP, static_cast<int>(step_kb)) != 0;
+	step_time += Event::Clock::now() - start;
+
+	last_heap_kb = GetHeapKB();
+	in_cycle = !finished;
+
+	if (finished) {
+		++n_cycles;
+		cycle_heap_kb = last_heap_kb;
+	}
+
+	return finished;
+}
+
+void
+LuaGcScheduler::FullCollect() noexcept
+{
+	const auto start = Event::Clock::now();
+	lua_gc(L, LUA_GCCOLLECT, 0);
+	step_time += Event::Clock::now() - start;
+
+	++n_cycles;
+	in_cycle = false;
+	last_heap_kb = cycle_heap_kb = GetHeapKB();
+}
+
+void
+LuaGcScheduler::CheckHotPath() noexcept
+{
+	const std::size_t heap_kb = GetHeapKB();
+
+	/* the loop has not been idle long enough to keep up; this
+	   threshold is what Lua's default "pause" would use */
+	const std::size_t hot_threshold_kb =
+		std::max(cycle_heap_kb * 2, MIN_HOT_THRESHOLD_KB);
+	if (heap_kb >= hot_threshold_kb) {
+		++n_hot_steps;
+		Step();
+	}
+
+	ScheduleIdle();
+}
+
+void
+LuaGcScheduler::OnIdle() noexcept
+{
+	/* start a new cycle only if the heap has grown by at least a
+	   quarter since the last one; this is more eager than Lua's
+	   default because idle time is cheap */
+	const std::size_t idle_threshold_kb =
+		std::max(cycle_heap_kb + cycle_heap_kb / 4,
+			 cycle_heap_kb + MIN_STEP_KB);
+	if (!in_cycle && GetHeapKB() < idle_threshold_kb)
+		return;
+
+	++n_idle_steps;
+	if (!Step())
+		/* continue the cycle as long as we're idle */
+		ScheduleIdle();
+}
+
+void
+LuaGcScheduler::OnTimer() noexcept
+{
+	ScheduleIdle();
+	timer.Schedule(std::chrono::seconds{1});
+}
+
+void
+LuaGcScheduler::WriteMetrics(std::string &out) const noexcept
+{
+	const std::size_t heap_bytes = static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 +
+		static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNTB, 0));
+
+	WriteMetric(out, "qrelay_lua_heap_bytes"sv, "gauge"sv,
+		    "Size of the Lua heap"sv,
+		    static_cast<uint_least64_t>(heap_bytes));
+
+	WriteMetricHeader(out, "qrelay_lua_gc_steps_total"sv, "counter"sv,
+			  "Number of incremental Lua GC steps"sv);
+	WriteMetricSample(out, "qrelay_lua_gc_steps_total"sv,
+			  "path=\"idle\""sv, n_idle_steps);
+	WriteMetricSample(out, "qrelay_lua_gc_steps_total"sv,
+			  "path=\"hot\""sv, n_hot_steps);
+
+	WriteMetric(out, "qrelay_lua_gc_cycles_total"sv, "counter"sv,
+		    "Number of completed Lua GC cycles"sv,
+		    n_cycles);
+	WriteMetric(out, "qrelay_lua_gc_seconds_total"sv, "counter"sv,
+		    "Time spent in the Lua garbage collector"sv,
+		    ToSeconds(step_time));
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/CoarseTimerEvent.hxx"
+#include "event/DeferEvent.hxx"
+#include "event/Chrono.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct lua_State;
+
+/**
+ * Drives the Lua garbage collector instead of letting allocations
+ * trigger collection steps (which would then run inside
+ * latency-critical handler invocations).  Incremental steps are
+ * performed when the #EventLoop is idle.  Only if the heap grows too
+ * much without the loop ever becoming idle, a step is performed on
+ * the "hot path" (right before a handler gets invoked).
+ *
+ * The automatic collector is not stopped, but its pause is raised
+ * so it only kicks in if Lua code allocates a lot without returning
+ * to the #EventLoop.
+ */
+class LuaGcScheduler {
+	/**
+	 * Minimum and maximum size of one incremental step
+	 * [kB].
+	 */
+	static constexpr std::size_t MIN_STEP_KB = 16, MAX_STEP_KB = 1024;
+
+	/**
+	 * Perform hot-path steps only if the heap is larger than
+	 * this [kB].
+	 */
+	static constexpr std::size_t MIN_HOT_THRESHOLD_KB = 4096;
+
+	/**
+	 * The "pause" [percent] of the automatic collector: it starts
+	 * a new cycle when the heap has grown to this size relative to
+	 * the last cycle, i.e. twice as late as the hot path.
+	 */
+	static constexpr int SAFETY_NET_PAUSE = 400;
+
+	lua_State *const L;
+
+	/**
+	 * Performs steps while the #EventLoop is idle.
+	 */
+	DeferEvent idle_event;
+
+	/**
+	 * Periodically checks whether there is garbage (allocated by
+	 * Lua code which did not pass our hot path, e.g. timers).
+	 */
+	CoarseTimerEvent timer;
+
+	/**
+	 * The heap size [kB] after the last step.
+	 */
+	std::size_t last_heap_kb = 0;
+
+	/**
+	 * The heap size [kB] after the last completed cycle.
+	 */
+	std::size_t cycle_heap_kb = 0;
+
+	/**
+	 * Is there a collection cycle in progress?
+	 */
+	bool in_cycle = false;
+
+	uint_least64_t n_idle_steps = 0, n_hot_steps = 0, n_cycles = 0;
+	Event::Duration step_time{};
+
+public:
+	LuaGcScheduler(EventLoop &event_loop, lua_State *_L) noexcept;
+
+	/**
+	 * Take over control of the garbage collector.
+	 */
+	void Start() noexcept;
+
+	void Stop() noexcept;
+
+	/**
+	 * Called right before a handler gets invoked.  Performs a
+	 * step if the heap has grown too much (because the loop has
+	 * not been idle for a while).
+	 */
+	void CheckHotPath() noexcept;
+
+	/**
+	 * Perform a full collection cycle now (e.g. after a
+	 * reload).
+	 */
+	void FullCollect() noexcept;
+
+	void WriteMetrics(std::string &out) const noexcept;
+
+private:
+	std::size_t GetHeapKB() const noexcept;
+
+	/**
+	 * Perform one incremental step whose size depends on how
+	 * much was allocated since the last one.
+	 *
+	 * @return true if the cycle has been completed
+	 */
+	bool Step() noexcept;
+
+	void ScheduleIdle() noexcept {
+		if (!idle_event.IsPending())
+			idle_event.ScheduleIdle();
+	}
+
+	void OnIdle() noexcept;
+	void OnTimer() noexcept;
+};
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "LuaReloadRunner.hxx"
+
+extern "C" {
+#include <lua.h>
+}
+
+#include <cassert>
+#include <utility> // for std::move()
+
+void
+LuaReloadRunner::Start() noexcept
+try {
+	assert(!IsRunning());
+
+	lua_getglobal(L, "reload");
+	const bool defined = lua_isfunction(L, -1);
+	lua_pop(L, 1);
+
+	if (!defined) {
+		callback({});
+		return;
+	}
+
+	/* release the previous (finished) coroutine */
+	runner.Cancel();
+	thread = runner.CreateThread(*this);
+	lua_getglobal(thread, "reload");
+	Lua::Resume(thread, 0);
+} catch (...) {
+	callback(std::current_exception());
+}
+
+void
+LuaReloadRunner::OnLuaFinished(lua_State *) noexcept
+{
+	thread = nullptr;
+	callback({});
+}
+
+void
+LuaReloadRunner::OnLuaError(lua_State *, std::exception_ptr &&error) noexcept
+{
+	thread = nullptr;
+	callback(std::move(error));
+}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "lua/CoRunner.hxx"
+#include "lua/Resume.hxx"
+#include "util/BindMethod.hxx"
+
+#include <exception>
+
+/**
+ * Runs the global Lua function "reload" (if one was defined) in a
+ * new coroutine.  Unlike Lua::ReloadRunner, this one notifies a
+ * callback when the function has finished, which may be long after
+ * Start() has returned if it yields (e.g. "blocklist:reload()").
+ */
+class LuaReloadRunner final : Lua::ResumeListener {
+	lua_State *const L;
+
+	Lua::CoRunner runner;
+
+	/**
+	 * The coroutine which runs "reload"; nullptr if no reload
+	 * is running.
+	 */
+	lua_State *thread = nullptr;
+
+	/**
+	 * Invoked when the reload has finished; the parameter is
+	 * null on success.
+	 */
+	using Callback = BoundMethod<void(std::exception_ptr error) noexcept>;
+	const Callback callback;
+
+public:
+	LuaReloadRunner(lua_State *_L, Callback _callback) noexcept
+		:L(_L), runner(_L), callback(_callback) {}
+
+	/**
+	 * Is the "reload" function currently running (i.e. has it
+	 * yielded)?
+	 */
+	bool IsRunning() const noexcept {
+		return thread != nullptr;
+	}
+
+	/**
+	 * Is this the coroutine which runs the "reload" function?
+	 * Only this one may yield to wait for something which cannot
+	 * be canceled (e.g. blocklist:reload()), because it is never
+	 * canceled while running.
+	 */
+	bool IsThread(const lua_State *_thread) const noexcept {
+		return thread != nullptr && _thread == thread;
+	}
+
+	/**
+	 * Start the "reload" function.  It must not be running
+	 * already (see IsRunning()).  The callback may be invoked
+	 * before this method returns.
+	 */
+	void Start() noexcept;
+
+private:
+	/* virtual methods from class Lua::ResumeListener */
+	void OnLuaFinished(lua_State *L) noexcept override;
+	void OnLuaError(lua_State *L, std::exception_ptr &&error) noexcept override;
+};
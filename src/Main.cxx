@@ -2,23 +2,32 @@
 // Copyright CM4all GmbH
 // author: Max Kellermann <max.kellermann@ionos.com>
 
+#include "Bench.hxx"
 #include "CommandLine.hxx"
 #include "Instance.hxx"
 #include "LResolver.hxx"
+#include "LBudget.hxx"
+#include "LPatternSet.hxx"
+#include "LDuplicateCache.hxx"
+#include "LCdb.hxx"
+#include "LBlocklist.hxx"
+#include "LCgroup.hxx"
+#include "LuaBytecodeCache.hxx"
 #include "lib/fmt/RuntimeError.hxx"
 #include "lib/fmt/SystemError.hxx"
 #include "system/SetupProcess.hxx"
+#include "net/AllocatedSocketAddress.hxx"
 #include "net/LocalSocketAddress.hxx"
+#include "net/Parser.hxx"
 #include "lua/LightUserData.hxx"
 #include "lua/Value.hxx"
 #include "lua/Util.hxx"
 #include "lua/Error.hxx"
+#include "lua/ForEach.hxx"
 #include "lua/PushCClosure.hxx"
 #include "lua/Resume.hxx"
 #include "lua/RunFile.hxx"
 #include "lua/StringView.hxx"
-#include "lua/io/XattrTable.hxx"
-#include "lua/io/CgroupInfo.hxx"
 #include "lua/net/Socket.hxx"
 #include "lua/net/SocketAddress.hxx"
 #include "lua/net/ControlClient.hxx"
@@ -32,6 +41,7 @@
 #endif
 
 #ifdef HAVE_LIBSODIUM
+#include "LDkim.hxx"
 #include "lua/sodium/Init.hxx"
 #endif
 
@@ -52,10 +62,18 @@ extern "C" {
 #include <systemd/sd-daemon.h>
 #endif
 
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cmath> // for std::isnormal()
+#include <string>
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h> // for chdir()
 
+using std::string_view_literals::operator""sv;
+
 #ifdef HAVE_LIBSYSTEMD
 
 /**
@@ -85,12 +103,102 @@ GetGlobalInt(lua_State *L, const char *name)
 	return lua_tointeger(L, -1);
 }
 
+static auto
+GetGlobalNumber(lua_State *L, const char *name)
+{
+	lua_getglobal(L, name);
+	AtScopeExit(L) { lua_pop(L, 1); };
+
+	if (!lua_isnumber(L, -1))
+		throw FmtRuntimeError("`{}` must be a number", name);
+
+	return lua_tonumber(L, -1);
+}
+
+static Event::Duration
+CheckSeconds(lua_State *L, Lua::AnyStackIndex auto idx, const char *name)
+{
+	if (!lua_isnumber(L, Lua::GetStackIndex(idx)))
+		throw FmtRuntimeError("`{}` is not a number", name);
+
+	const auto seconds = lua_tonumber(L, Lua::GetStackIndex(idx));
+	if (!std::isnormal(seconds) || seconds <= 0 || seconds > 3600)
+		throw FmtRuntimeError("Bad `{}` value", name);
+
+	return std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{seconds});
+}
+
+/**
+ * Collect parameters from the "options" table passed as the last
+ * parameter to qmqp_listen().
+ */
+static void
+CollectListenerOptions(ListenerConfig &config, lua_State *L,
+		       Lua::AnyStackIndex auto idx)
+{
+	Lua::ForEach(L, idx, [L, &config](auto key_idx, auto value_idx){
+		if (lua_type(L, Lua::GetStackIndex(key_idx)) != LUA_TSTRING)
+			throw std::runtime_error("Option key is not a string");
+
+		const auto key = Lua::ToStringView(L, Lua::GetStackIndex(key_idx));
+		if (key == "cpu_budget"sv)
+			config.cpu_budget = CheckSeconds(L, value_idx, "cpu_budget");
+		else if (key == "header_timeout"sv)
+			config.receive_limits.header_timeout = CheckSeconds(L, value_idx, "header_timeout");
+		else if (key == "receive_timeout"sv)
+			config.receive_limits.total_timeout = CheckSeconds(L, value_idx, "receive_timeout");
+		else if (key == "idle_timeout"sv)
+			config.receive_limits.idle_timeout = CheckSeconds(L, value_idx, "idle_timeout");
+		else if (key == "min_rate"sv) {
+			if (!lua_isnumber(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`min_rate` must be a number");
+
+			const auto min_rate = lua_tointeger(L, Lua::GetStackIndex(value_idx));
+			if (min_rate < 0)
+				throw std::runtime_error("`min_rate` must not be negative");
+
+			config.receive_limits.min_rate = static_cast<std::size_t>(min_rate);
+		} else if (key == "on_connect"sv) {
+			if (!lua_isfunction(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`on_connect` must be a function");
+
+			config.on_connect = std::make_shared<Lua::Value>(L, value_idx);
+		} else if (key == "backlog"sv) {
+			if (!lua_isnumber(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`backlog` must be a number");
+
+			const auto backlog = lua_tointeger(L, Lua::GetStackIndex(value_idx));
+			if (backlog < 1 || backlog > 65535)
+				throw std::runtime_error("Bad `backlog` value");
+
+			config.backlog = static_cast<unsigned>(backlog);
+		} else if (key == "reuse_port"sv) {
+			if (!lua_isboolean(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`reuse_port` must be a boolean");
+
+			config.reuse_port = lua_toboolean(L, Lua::GetStackIndex(value_idx));
+		} else if (key == "body_hash"sv) {
+			if (!lua_isboolean(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`body_hash` must be a boolean");
+
+#ifndef HAVE_LIBSODIUM
+			if (lua_toboolean(L, Lua::GetStackIndex(value_idx)))
+				throw std::runtime_error("`body_hash` requires libsodium");
+#endif
+
+			config.body_hash = lua_toboolean(L, Lua::GetStackIndex(value_idx));
+		} else
+			throw FmtRuntimeError("Unknown option `{}`", key);
+	});
+}
+
 static int
 l_qmqp_listen(lua_State *L)
 try {
 	auto &instance = *(Instance *)lua_touserdata(L, lua_upvalueindex(1));
 
-	if (lua_gettop(L) != 2)
+	const int top = lua_gettop(L);
+	if (top < 2 || top > 3)
 		return luaL_error(L, "Invalid parameter count");
 
 	if (!lua_isfunction(L, 2))
@@ -102,15 +210,46 @@ try {
 	if (max_size > 1024 * 1024 * 1024)
 		throw std::runtime_error("`max_size` is too large");
 
+	ListenerConfig config{
+		.max_size = static_cast<std::size_t>(max_size),
+	};
+
+	if (top >= 3) {
+		if (!lua_istable(L, 3))
+			return luaL_argerror(L, 3, "table expected");
+
+		CollectListenerOptions(config, L, Lua::StackIndex{3});
+	}
+
+	if (config.cpu_budget.count() > 0)
+		/* the budget hook cannot interrupt JIT-compiled code */
+		DisableLuaJitForBudget(L, 2);
+
 	auto handler = std::make_shared<Lua::Value>(L, Lua::StackIndex(2));
 
 	if (lua_type(L, 1) == LUA_TSTRING) {
 		const auto address_string = Lua::ToStringView(L, 1);
-
-		instance.AddListener(LocalSocketAddress{address_string}, max_size, std::move(handler));
+		config.name = address_string;
+
+		if (address_string.starts_with("tcp:"sv)) {
+			/* copy to a null-terminated string */
+			const std::string host{address_string.substr(4)};
+			const auto address = ParseSocketAddress(host.c_str(),
+								628, true);
+
+			instance.AddListener(address,
+					     instance.MakeListenerConfig(std::move(config)),
+					     std::move(handler));
+		} else
+			instance.AddListener(LocalSocketAddress{address_string},
+					     instance.MakeListenerConfig(std::move(config)),
+					     std::move(handler));
 #ifdef HAVE_LIBSYSTEMD
 	} else if (IsSystemdMagic(L, 1)) {
-		instance.AddSystemdListener(max_size, std::move(handler));
+		config.name = "systemd"sv;
+
+		instance.AddSystemdListener(instance.MakeListenerConfig(std::move(config)),
+					    std::move(handler));
 #endif
 	} else
 		luaL_argerror(L, 1, "path expected");
@@ -120,6 +259,20 @@ try {
 	Lua::RaiseCurrent(L);
 }
 
+static int
+l_metrics_listen(lua_State *L)
+try {
+	auto &instance = *(Instance *)lua_touserdata(L, lua_upvalueindex(1));
+
+	if (lua_gettop(L) != 1)
+		return luaL_error(L, "Invalid parameter count");
+
+	instance.AddMetricsListener(Lua::ToSocketAddress(L, 1, 9628));
+	return 0;
+} catch (...) {
+	Lua::RaiseCurrent(L);
+}
+
 static void
 SetupConfigState(lua_State *L, Instance &instance)
 {
@@ -148,10 +301,28 @@ SetupConfigState(lua_State *L, Instance &instance)
 	Lua::InitSocket(L);
 	Lua::InitControlClient(L);
 	RegisterLuaResolver(L);
+	RegisterLuaPatternSet(L);
+	RegisterLuaDuplicateCache(L, instance);
+	RegisterLuaCdb(L);
+	RegisterLuaBlocklist(L, instance);
+
+#ifdef HAVE_LIBSODIUM
+	RegisterLuaDkim(L);
+#endif
 
 	static constexpr lua_Integer DEFAULT_MAX_SIZE = 16 * 1024 * 1024;
 	Lua::SetGlobal(L, "max_size", DEFAULT_MAX_SIZE);
 
+	static constexpr lua_Number DEFAULT_SLOW_CALLBACK_THRESHOLD = 0.1;
+	Lua::SetGlobal(L, "slow_callback_threshold",
+		       DEFAULT_SLOW_CALLBACK_THRESHOLD);
+
+	static constexpr lua_Integer DEFAULT_DNS_CACHE_TTL = 60;
+	Lua::SetGlobal(L, "dns_cache_ttl", DEFAULT_DNS_CACHE_TTL);
+
+	static constexpr lua_Integer DEFAULT_DRAIN_TIMEOUT = 30;
+	Lua::SetGlobal(L, "drain_timeout", DEFAULT_DRAIN_TIMEOUT);
+
 #ifdef HAVE_LIBSYSTEMD
 	Lua::SetGlobal(L, "systemd", Lua::LightUserData(&systemd_magic));
 #endif
@@ -159,6 +330,10 @@ SetupConfigState(lua_State *L, Instance &instance)
 	Lua::SetGlobal(L, "qmqp_listen",
 		       Lua::MakeCClosure(l_qmqp_listen,
 					 Lua::LightUserData(&instance)));
+
+	Lua::SetGlobal(L, "metrics_listen",
+		       Lua::MakeCClosure(l_metrics_listen,
+					 Lua::LightUserData(&instance)));
 }
 
 static void
@@ -174,42 +349,108 @@ ChdirContainingDirectory(const char *path)
 }
 
 static void
-LoadConfigFile(lua_State *L, const char *path)
+LoadConfigFile(lua_State *L, const char *path,
+	       LuaBytecodeCache *bytecode_cache=nullptr)
 {
 	ChdirContainingDirectory(path);
-	Lua::RunFile(L, path);
+
+	if (bytecode_cache != nullptr) {
+		bytecode_cache->LoadFile(L, path);
+		if (lua_pcall(L, 0, 0, 0) != 0)
+			throw Lua::PopError(L);
+	} else
+		Lua::RunFile(L, path);
 
 	if (chdir("/") < 0)
 		throw FmtErrno("Failed to change to {}", "/");
 }
 
+static void
+ApplyGlobalSettings(lua_State *L, Instance &instance)
+{
+	const auto slow_callback_threshold =
+		GetGlobalNumber(L, "slow_callback_threshold");
+	if (slow_callback_threshold <= 0)
+		throw std::runtime_error("`slow_callback_threshold` must be positive");
+
+	instance.GetLoopMonitor().SetSlowThreshold(std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{slow_callback_threshold}));
+
+	const auto dns_cache_ttl = GetGlobalNumber(L, "dns_cache_ttl");
+	if (dns_cache_ttl <= 0)
+		throw std::runtime_error("`dns_cache_ttl` must be positive");
+
+	instance.GetResolverCache().SetTtl(std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{dns_cache_ttl}));
+
+	const auto drain_timeout = GetGlobalNumber(L, "drain_timeout");
+	if (drain_timeout <= 0)
+		throw std::runtime_error("`drain_timeout` must be positive");
+
+	instance.SetDrainTimeout(std::chrono::duration_cast<Event::Duration>(std::chrono::duration<lua_Number>{drain_timeout}));
+}
+
 static void
 SetupRuntimeState(lua_State *L)
 {
 	Lua::SetGlobal(L, "max_size", nullptr);
+	Lua::SetGlobal(L, "slow_callback_threshold", nullptr);
+	Lua::SetGlobal(L, "dns_cache_ttl", nullptr);
+	Lua::SetGlobal(L, "drain_timeout", nullptr);
 	Lua::SetGlobal(L, "qmqp_listen", nullptr);
+	Lua::SetGlobal(L, "metrics_listen", nullptr);
 
-	Lua::InitXattrTable(L);
-	Lua::RegisterCgroupInfo(L);
+	RegisterLuaCgroup(L);
 
 	QmqpRelayConnection::Register(L);
 
 	UnregisterLuaResolver(L);
+	UnregisterLuaPatternSet(L);
+	UnregisterLuaDuplicateCache(L);
+	UnregisterLuaCdb(L);
+	UnregisterLuaBlocklist(L);
+
+#ifdef HAVE_LIBSODIUM
+	UnregisterLuaDkim(L);
+#endif
 }
 
 static int
 Run(const CommandLine &cmdline)
 {
 	Instance instance;
+	if (!cmdline.handover_path.empty())
+		instance.SetHandoverPath(cmdline.handover_path.c_str());
+
 	SetupConfigState(instance.GetLuaState(), instance);
 
-	LoadConfigFile(instance.GetLuaState(), cmdline.config_path.c_str());
+	/* systemd sets this variable if the unit has a
+	   "CacheDirectory" */
+	if (const char *cache_directory = getenv("CACHE_DIRECTORY"))
+		instance.EnableBytecodeCache(cache_directory);
+
+	const auto load_start = std::chrono::steady_clock::now();
+
+	LoadConfigFile(instance.GetLuaState(), cmdline.config_path.c_str(),
+		       instance.GetBytecodeCache());
+
+	const std::chrono::duration<double> load_duration =
+		std::chrono::steady_clock::now() - load_start;
+	if (const auto *cache = instance.GetBytecodeCache())
+		instance.logger(2, fmt::format("Configuration loaded in {:.3f}s ({} Lua files from the bytecode cache, {} compiled)"sv,
+					       load_duration.count(),
+					       cache->GetHits(), cache->GetMisses()).c_str());
+	else
+		instance.logger(2, fmt::format("Configuration loaded in {:.3f}s (no bytecode cache)"sv,
+					       load_duration.count()).c_str());
 
 	instance.Check();
 	instance.SetupLogSocket();
+	ApplyGlobalSettings(instance.GetLuaState(), instance);
 
 	SetupRuntimeState(instance.GetLuaState());
 
+	instance.SetupHandover();
+	instance.Start();
+
 #ifdef HAVE_LIBSYSTEMD
 	/* tell systemd we're ready */
 	sd_notify(0, "READY=1");
@@ -220,6 +461,32 @@ Run(const CommandLine &cmdline)
 	return EXIT_SUCCESS;
 }
 
+/**
+ * Load the configuration without creating sockets and feed the
+ * recorded mails through all handlers.
+ */
+static int
+Bench(const CommandLine &cmdline)
+{
+	/* load the corpus before LoadConfigFile() changes the working
+	   directory */
+	const auto corpus = LoadBenchCorpus(cmdline.bench_path.c_str());
+
+	Instance instance;
+	instance.SetDryRun();
+	SetupConfigState(instance.GetLuaState(), instance);
+
+	LoadConfigFile(instance.GetLuaState(), cmdline.config_path.c_str());
+
+	instance.Check();
+	ApplyGlobalSettings(instance.GetLuaState(), instance);
+
+	SetupRuntimeState(instance.GetLuaState());
+
+	RunBench(instance, corpus);
+	return EXIT_SUCCESS;
+}
+
 int
 main(int argc, char **argv) noexcept
 try {
@@ -232,6 +499,9 @@ try {
 	setvbuf(stdout, nullptr, _IOLBF, 0);
 	setvbuf(stderr, nullptr, _IOLBF, 0);
 
+	if (!cmdline.bench_path.empty())
+		return Bench(cmdline);
+
 	return Run(cmdline);
 } catch (...) {
 	PrintException(std::current_exception());
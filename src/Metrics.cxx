@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "Metrics.hxx"
+
+#include <fmt/format.h>
+
+#include <iterator>
+
+using std::string_view_literals::operator""sv;
+
+std::string
+MakeMetricLabel(std::string_view name, std::string_view value) noexcept
+{
+	std::string result{name};
+	result += "=\""sv;
+
+	for (const char ch : value) {
+		switch (ch) {
+		case '\\':
+		case '"':
+			result.push_back('\\');
+			result.push_back(ch);
+			break;
+
+		case '\n':
+			result += "\\n"sv;
+			break;
+
+		default:
+			result.push_back(ch);
+		}
+	}
+
+	result.push_back('"');
+	return result;
+}
+
+void
+WriteMetricHeader(std::string &out, std::string_view name,
+		  std::string_view type, std::string_view help) noexcept
+{
+	fmt::format_to(std::back_inserter(out),
+		       "# HELP {} {}\n# TYPE {} {}\n"sv,
+		       name, help, name, type);
+}
+
+void
+WriteMetric(std::string &out, std::string_view name,
+	    std::string_view type, std::string_view help,
+	    uint_least64_t value) noexcept
+{
+	WriteMetricHeader(out, name, type, help);
+	WriteMetricSample(out, name, {}, value);
+}
+
+void
+WriteMetric(std::string &out, std::string_view name,
+	    std::string_view type, std::string_view help,
+	    double value) noexcept
+{
+	WriteMetricHeader(out, name, type, help);
+	WriteMetricSample(out, name, {}, value);
+}
+
+void
+WriteMetricSample(std::string &out, std::string_view name,
+		  std::string_view labels, uint_least64_t value) noexcept
+{
+	if (labels.empty())
+		fmt::format_to(std::back_inserter(out), "{} {}\n"sv,
+			       name, value);
+	else
+		fmt::format_to(std::back_inserter(out), "{}{{{}}} {}\n"sv,
+			       name, labels, value);
+}
+
+void
+WriteMetricSample(std::string &out, std::string_view name,
+		  std::string_view labels, double value) noexcept
+{
+	if (labels.empty())
+		fmt::format_to(std::back_inserter(out), "{} {}\n"sv,
+			       name, value);
+	else
+		fmt::format_to(std::back_inserter(out), "{}{{{}}} {}\n"sv,
+			       name, labels, value);
+}
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/*
+ * Helpers for generating the Prometheus text exposition format.
+ */
+
+/**
+ * Format a `name="value"` label pair, escaping the value.
+ */
+std::string
+MakeMetricLabel(std::string_view name, std::string_view value) noexcept;
+
+void
+WriteMetricHeader(std::string &out, std::string_view name,
+		  std::string_view type, std::string_view help) noexcept;
+
+void
+WriteMetric(std::string &out, std::string_view name,
+	    std::string_view type, std::string_view help,
+	    uint_least64_t value) noexcept;
+
+void
+WriteMetric(std::string &out, std::string_view name,
+	    std::string_view type, std::string_view help,
+	    double value) noexcept;
+
+/**
+ * Write a sample line without a header; @p labels is a
+ * comma-separated list of `key="value"` pairs (without the
+ * braces).
+ */
+void
+WriteMetricSample(std::string &out, std::string_view name,
+		  std::string_view labels, uint_least64_t value) noexcept;
+
+void
+WriteMetricSample(std::string &out, std::string_view name,
+		  std::string_view labels, double value) noexcept;
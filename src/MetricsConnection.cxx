@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "MetricsConnection.hxx"
+#include "Instance.hxx"
+
+#include <array>
+#include <cerrno>
+
+#include <sys/socket.h>
+
+using std::string_view_literals::operator""sv;
+
+MetricsConnection::MetricsConnection(Instance &_instance,
+				     UniqueSocketDescriptor &&_fd,
+				     SocketAddress) noexcept
+	:instance(_instance),
+	 fd(std::move(_fd)),
+	 event(_instance.GetEventLoop(), BIND_THIS_METHOD(OnSocketReady), fd),
+	 timeout(_instance.GetEventLoop(), BIND_THIS_METHOD(OnTimeout))
+{
+	event.ScheduleRead();
+	timeout.Schedule(std::chrono::seconds{10});
+}
+
+MetricsConnection::~MetricsConnection() noexcept
+{
+	event.Cancel();
+}
+
+inline void
+MetricsConnection::OnRequest() noexcept
+{
+	/* we don't care about the request; just consume it so closing
+	   the socket doesn't send RST */
+	std::array<std::byte, 4096> discard;
+	if (recv(fd.Get(), discard.data(), discard.size(), MSG_DONTWAIT) <= 0) {
+		delete this;
+		return;
+	}
+
+	response = "HTTP/1.1 200 OK\r\n"
+		"Content-Type: text/plain; version=0.0.4\r\n"
+		"Connection: close\r\n"
+		"\r\n"sv;
+
+	instance.WriteMetrics(response);
+
+	event.CancelRead();
+	SendResponse();
+}
+
+void
+MetricsConnection::SendResponse() noexcept
+{
+	while (response_position < response.size()) {
+		const auto nbytes = send(fd.Get(),
+					 response.data() + response_position,
+					 response.size() - response_position,
+					 MSG_DONTWAIT|MSG_NOSIGNAL);
+		if (nbytes < 0) {
+			if (errno == EAGAIN) {
+				/* the socket buffer is full; continue
+				   when the client has read some of it */
+				event.ScheduleWrite();
+				return;
+			}
+
+			delete this;
+			return;
+		}
+
+		response_position += nbytes;
+	}
+
+	shutdown(fd.Get(), SHUT_WR);
+
+	delete this;
+}
+
+void
+MetricsConnection::OnSocketReady(unsigned) noexcept
+{
+	if (response.empty())
+		OnRequest();
+	else
+		SendResponse();
+}
+
+void
+MetricsConnection::OnTimeout() noexcept
+{
+	delete this;
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/CoarseTimerEvent.hxx"
+#include "event/SocketEvent.hxx"
+#include "event/net/TemplateServerSocket.hxx"
+#include "net/UniqueSocketDescriptor.hxx"
+#include "util/IntrusiveList.hxx"
+
+#include <cstddef>
+#include <string>
+
+class Instance;
+class SocketAddress;
+
+/**
+ * A connection to the metrics listener.  It waits for the (HTTP)
+ * request, discards it, responds with all metrics in the
+ * Prometheus text format and closes the connection.
+ */
+class MetricsConnection final : public AutoUnlinkIntrusiveListHook {
+	Instance &instance;
+
+	UniqueSocketDescriptor fd;
+	SocketEvent event;
+	CoarseTimerEvent timeout;
+
+	/**
+	 * The response; empty while we're waiting for the request.
+	 */
+	std::string response;
+
+	/**
+	 * The number of #response bytes already sent.
+	 */
+	std::size_t response_position = 0;
+
+public:
+	MetricsConnection(Instance &_instance,
+			  UniqueSocketDescriptor &&_fd, SocketAddress address) noexcept;
+	~MetricsConnection() noexcept;
+
+private:
+	void OnRequest() noexcept;
+
+	/**
+	 * Send as much of the #response as the socket accepts; if it
+	 * is complete, close the connection (i.e. destroy this
+	 * object).
+	 */
+	void SendResponse() noexcept;
+
+	void OnSocketReady(unsigned events) noexcept;
+	void OnTimeout() noexcept;
+};
+
+using MetricsListener = TemplateServerSocket<MetricsConnection, Instance &>;
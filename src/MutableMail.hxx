@@ -5,14 +5,36 @@
 #ifndef QRELAY_MUTABLE_MAIL_HXX
 #define QRELAY_MUTABLE_MAIL_HXX
 
+#include "BodyHash.hxx"
+#include "DuplicateCache.hxx"
+#include "SealedMemfd.hxx"
 #include "djb/QmqpMail.hxx"
 #include "util/AllocatedArray.hxx"
 
 #include <forward_list>
+#include <memory>
+#include <optional>
 #include <string>
 
 #include <stdint.h>
 
+/**
+ * The memory which a #QmqpMail points into, shared by all relays of
+ * a fan-out (see MutableMail::ShareBuffer()).
+ */
+struct MailBuffer {
+	AllocatedArray<std::byte> buffer;
+	SealedMemfd memfd;
+
+	MailBuffer(AllocatedArray<std::byte> &&_buffer,
+		   SealedMemfd &&_memfd) noexcept
+		:buffer(std::move(_buffer)), memfd(std::move(_memfd)) {}
+
+	std::size_t GetSize() const noexcept {
+		return buffer.size() + memfd.GetSize();
+	}
+};
+
 /**
  * An extension of #QmqpMail which allows editing certain aspects of
  * the mail.
@@ -24,6 +46,19 @@ struct MutableMail : QmqpMail {
 	 */
 	AllocatedArray<std::byte> buffer;
 
+	/**
+	 * If the mail was submitted in a memfd, then this is where
+	 * the #QmqpMail's #std::string_view instances point into
+	 * (and #buffer is empty).
+	 */
+	SealedMemfd memfd;
+
+	/**
+	 * After ShareBuffer(), this owns the memory (and #buffer and
+	 * #memfd are empty).
+	 */
+	std::shared_ptr<const MailBuffer> shared_buffer;
+
 	/**
 	 * If the sender was modified, then this object owns the
 	 * memory pointed to by QmqpMail::sender.
@@ -41,8 +76,65 @@ struct MutableMail : QmqpMail {
 	 */
 	std::string account;
 
-	explicit MutableMail(AllocatedArray<std::byte> &&_buffer)
-		:buffer(_buffer) {}
+	/**
+	 * The hash of the message body (only if enabled with the
+	 * "body_hash" listener option).
+	 */
+	std::optional<BodyHash> body_hash;
+
+	/**
+	 * If set, then the Lua handler has checked this mail against
+	 * a #DuplicateCache, and #duplicate_key shall be added to
+	 * it once the mail has been accepted.
+	 */
+	DuplicateCache *duplicate_cache = nullptr;
+	DuplicateCache::Key duplicate_key;
+
+	/**
+	 * A number which identifies this mail; it is assigned by
+	 * NewLuaMail() and copied to #Action objects which are only
+	 * valid for this mail (see Action::mail_id).
+	 */
+	uint_least64_t id = 0;
+
+	explicit MutableMail(AllocatedArray<std::byte> &&_buffer) noexcept
+		:buffer(std::move(_buffer)) {}
+
+	/**
+	 * Construct from a #QmqpMail which has already been parsed
+	 * (e.g. by #QmqpParser) and points into @p _buffer.
+	 */
+	MutableMail(AllocatedArray<std::byte> &&_buffer, QmqpMail &&_mail) noexcept
+		:QmqpMail(std::move(_mail)), buffer(std::move(_buffer)) {}
+
+	/**
+	 * Construct from a #QmqpMail which has already been parsed
+	 * and points into @p _memfd.
+	 */
+	MutableMail(SealedMemfd &&_memfd, QmqpMail &&_mail) noexcept
+		:QmqpMail(std::move(_mail)), memfd(std::move(_memfd)) {}
+
+	/**
+	 * The size of the QMQP payload.
+	 */
+	std::size_t GetPayloadSize() const noexcept {
+		return buffer.size() + memfd.GetSize() +
+			(shared_buffer ? shared_buffer->GetSize() : 0);
+	}
+
+	/**
+	 * Move the memory which the #QmqpMail's #std::string_view
+	 * instances point into to a reference-counted #MailBuffer
+	 * (without copying the data), so it can outlive this object.
+	 *
+	 * Throws std::bad_alloc.
+	 */
+	std::shared_ptr<const MailBuffer> ShareBuffer() {
+		if (!shared_buffer)
+			shared_buffer = std::make_shared<const MailBuffer>(std::move(buffer),
+									   std::move(memfd));
+		return shared_buffer;
+	}
 
 	/**
 	 * Clear this object and free all C++ heap allocations.
@@ -50,9 +142,13 @@ struct MutableMail : QmqpMail {
 	void Free() noexcept {
 		*static_cast<QmqpMail *>(this) = {};
 		buffer = nullptr;
+		memfd = {};
+		shared_buffer.reset();
 		sender_buffer.clear();
 		headers.clear();
 		account.clear();
+		body_hash.reset();
+		duplicate_cache = nullptr;
 	}
 
 	ParseResult Parse() noexcept {
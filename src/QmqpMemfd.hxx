@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+/*
+ * The memfd submission protocol: instead of sending the QMQP
+ * netstring through the socket, a local client writes the QMQP
+ * payload (the contents of the outer netstring) into a memfd, seals
+ * it with at least #QMQP_MEMFD_REQUIRED_SEALS and sends the single
+ * byte #QMQP_MEMFD_MAGIC together with the memfd (SCM_RIGHTS) as the
+ * first (and only) data on the connection.  The response is a
+ * regular QMQP response netstring.
+ */
+
+#include <fcntl.h>
+
+/**
+ * The byte which accompanies the file descriptor.  It cannot be the
+ * first byte of a netstring.
+ */
+static constexpr char QMQP_MEMFD_MAGIC = 'M';
+
+/**
+ * These seals guarantee that the memfd contents cannot change (and
+ * the file cannot shrink) while qrelay has them mapped.
+ */
+static constexpr int QMQP_MEMFD_REQUIRED_SEALS =
+	F_SEAL_SHRINK|F_SEAL_WRITE;
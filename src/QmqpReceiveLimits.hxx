@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/Chrono.hxx"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Deadlines for receiving a request, see #QmqpServer.
+ */
+struct QmqpReceiveLimits {
+	/**
+	 * The netstring header must be received within this
+	 * duration after the connection was accepted.
+	 */
+	Event::Duration header_timeout = std::chrono::seconds{30};
+
+	/**
+	 * The whole request must be received within this duration
+	 * after the connection was accepted.
+	 */
+	Event::Duration total_timeout = std::chrono::minutes{10};
+
+	/**
+	 * Give up if the client does not send anything for this
+	 * long.
+	 */
+	Event::Duration idle_timeout = std::chrono::minutes{1};
+
+	/**
+	 * The minimum average number of payload bytes per second
+	 * (measured from the end of the netstring header).  Zero
+	 * disables this check.
+	 */
+	std::size_t min_rate = 0;
+};
+
+/**
+ * Why QmqpServer::OnReceiveTimeout() was called.
+ */
+enum class QmqpReceiveTimeout : uint_least8_t {
+	HEADER,
+	TOTAL,
+	IDLE,
+	SLOW,
+};
+
+static constexpr std::size_t N_QMQP_RECEIVE_TIMEOUTS = 4;
+
+const char *
+ToString(QmqpReceiveTimeout reason) noexcept;
@@ -0,0 +1,431 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "QmqpServer.hxx"
+#include "QmqpMemfd.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+#include "system/Error.hxx"
+#include "util/NumberParser.hxx"
+#include "util/SpanCast.hxx"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include <sys/socket.h>
+
+using std::string_view_literals::operator""sv;
+
+/**
+ * QmqpReceiveLimits::min_rate is only checked after the payload has
+ * been received for this long, so the TCP window can open up.
+ */
+static constexpr Event::Duration min_rate_grace = std::chrono::seconds{10};
+
+/**
+ * How often QmqpReceiveLimits::min_rate is checked.
+ */
+static constexpr Event::Duration min_rate_interval = std::chrono::seconds{5};
+
+const char *
+ToString(QmqpReceiveTimeout reason) noexcept
+{
+	switch (reason) {
+	case QmqpReceiveTimeout::HEADER:
+		return "header";
+
+	case QmqpReceiveTimeout::TOTAL:
+		return "total";
+
+	case QmqpReceiveTimeout::IDLE:
+		return "idle";
+
+	case QmqpReceiveTimeout::SLOW:
+		return "slow";
+	}
+
+	return "?";
+}
+
+QmqpServer::QmqpServer(EventLoop &event_loop, UniqueSocketDescriptor &&_fd,
+		       std::size_t _max_size,
+		       const QmqpReceiveLimits &_limits) noexcept
+	:fd(std::move(_fd)),
+	 event(event_loop, BIND_THIS_METHOD(OnSocketReady), fd),
+	 timeout_event(event_loop, BIND_THIS_METHOD(OnTimeout)),
+	 max_size(_max_size),
+	 limits(_limits),
+	 accept_time(event_loop.SteadyNow()),
+	 last_receive(accept_time)
+{
+	event.ScheduleRead();
+	ScheduleTimeout(accept_time);
+}
+
+QmqpServer::~QmqpServer() noexcept = default;
+
+bool
+QmqpServer::SendResponse(std::string_view response) noexcept
+try {
+	const auto netstring = fmt::format("{}:{},"sv, response.size(), response);
+
+	/* the response is small enough to fit into the socket
+	   buffer, so a short write is treated as an error */
+	const auto nbytes = fd.Send(AsBytes(netstring), MSG_DONTWAIT|MSG_NOSIGNAL);
+	if (nbytes < 0)
+		throw MakeErrno("Failed to send");
+
+	if (static_cast<std::size_t>(nbytes) < netstring.size())
+		throw std::runtime_error{"Short send"};
+
+	return true;
+} catch (...) {
+	OnError(std::current_exception());
+	return false;
+}
+
+inline bool
+QmqpServer::ParseHeader()
+{
+	const std::string_view header{header_buffer, header_fill};
+
+	const auto colon = header.find(':');
+	if (colon == header.npos) {
+		if (header_fill >= sizeof(header_buffer))
+			throw std::runtime_error{"Malformed netstring header"};
+
+		return false;
+	}
+
+	const auto length_string = header.substr(0, colon);
+
+	std::size_t size;
+	if (!ParseIntegerTo(length_string, size) ||
+	    (size > 0 && length_string.front() == '0'))
+		throw std::runtime_error{"Malformed netstring header"};
+
+	if (size > max_size)
+		throw std::runtime_error{"Netstring is too large"};
+
+	const auto rest = AsBytes(header.substr(colon + 1));
+
+	if (!OnHeader(size)) {
+		/* some of the payload may have been received
+		   together with the header */
+		skip_remaining = size + 1 - std::min(rest.size(), size + 1);
+		return true;
+	}
+
+	/* allocate the payload plus the trailing comma and copy
+	   the payload bytes which were received together with the
+	   header */
+	payload = AllocatedArray<std::byte>(size + 1);
+
+	payload_fill = std::min(rest.size(), payload.size());
+	std::copy_n(rest.begin(), payload_fill, payload.begin());
+
+	parser.emplace(size);
+	return true;
+}
+
+inline void
+QmqpServer::FeedParser()
+{
+	const std::size_t size = payload.size() - 1;
+
+	const auto received = ToStringView(std::span<const std::byte>{payload.data(), std::min(payload_fill, size)});
+	const auto result = parser->Feed(received);
+
+#ifdef HAVE_LIBSODIUM
+	if (body_hasher)
+		body_hasher->Feed(parser->GetPartialMessage(received));
+#endif
+
+	if (!result)
+		return;
+
+	if (*result != QmqpMail::ParseResult::SUCCESS) {
+		/* no need to parse the rest, but receive and discard
+		   it before responding, because the client will not
+		   read the response before it has sent everything */
+		skip_remaining = payload.size() - payload_fill;
+		bad_request = *result;
+
+		parser.reset();
+		payload = AllocatedArray<std::byte>{};
+#ifdef HAVE_LIBSODIUM
+		body_hasher.reset();
+#endif
+
+		if (skip_remaining == 0)
+			Skipped();
+		return;
+	}
+
+	if (payload_fill < payload.size())
+		/* wait for the trailing comma */
+		return;
+
+	if (payload.back() != std::byte{','})
+		throw std::runtime_error{"Malformed netstring"};
+
+	/* from now on, only watch for the client closing the
+	   connection (which cancels the request) */
+	event.ScheduleImplicit();
+	timeout_event.Cancel();
+
+	QmqpMail mail = std::move(parser->GetMail());
+	parser.reset();
+
+#ifdef HAVE_LIBSODIUM
+	if (body_hasher) {
+		body_hash = body_hasher->Finish();
+		body_hasher.reset();
+	}
+#endif
+
+	payload.SetSize(size);
+	OnRequest(std::move(payload), std::move(mail));
+}
+
+inline void
+QmqpServer::Skipped() noexcept
+{
+	event.Cancel();
+	timeout_event.Cancel();
+
+	if (bad_request)
+		OnBadRequest(*bad_request);
+	else
+		OnSkipped();
+}
+
+inline ssize_t
+QmqpServer::ReceiveFirst(std::span<std::byte> dest,
+			 UniqueFileDescriptor &memfd_r)
+{
+	struct iovec iov{
+		.iov_base = dest.data(),
+		.iov_len = dest.size(),
+	};
+
+	/* room for one file descriptor only; if the client sends
+	   more, MSG_CTRUNC is set */
+	alignas(struct cmsghdr) std::array<std::byte, CMSG_SPACE(sizeof(int))> control;
+
+	struct msghdr msg{
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+		.msg_control = control.data(),
+		.msg_controllen = control.size(),
+	};
+
+	const auto nbytes = recvmsg(fd.Get(), &msg, MSG_DONTWAIT|MSG_CMSG_CLOEXEC);
+	if (nbytes < 0)
+		return nbytes;
+
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+	     cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET ||
+		    cmsg->cmsg_type != SCM_RIGHTS ||
+		    cmsg->cmsg_len < CMSG_LEN(sizeof(int)))
+			continue;
+
+		int value;
+		std::copy_n(CMSG_DATA(cmsg), sizeof(value),
+			    reinterpret_cast<unsigned char *>(&value));
+		memfd_r = UniqueFileDescriptor{AdoptTag{}, value};
+	}
+
+	if (msg.msg_flags & MSG_CTRUNC)
+		/* the kernel has closed the descriptors which did
+		   not fit */
+		throw std::runtime_error{"Too many file descriptors"};
+
+	return nbytes;
+}
+
+inline void
+QmqpServer::HandleMemfd(UniqueFileDescriptor &&memfd)
+{
+	/* nothing more is expected; only watch for the client
+	   closing the connection (which cancels the request) */
+	event.ScheduleImplicit();
+	timeout_event.Cancel();
+
+	const std::size_t size = CheckSealedMemfd(memfd);
+	if (size > max_size)
+		throw std::runtime_error{"Memfd is too large"};
+
+	if (!OnHeader(size)) {
+		OnSkipped();
+		return;
+	}
+
+	if (size == 0) {
+		OnBadRequest(QmqpMail::ParseResult::MALFORMED);
+		return;
+	}
+
+	SealedMemfd mapping{memfd, size};
+	memfd.Close();
+
+	QmqpMail mail;
+	if (const auto result = mail.Parse(mapping);
+	    result != QmqpMail::ParseResult::SUCCESS) {
+		OnBadRequest(result);
+		return;
+	}
+
+#ifdef HAVE_LIBSODIUM
+	if (body_hasher) {
+		body_hasher->Feed(mail.message);
+		body_hash = body_hasher->Finish();
+		body_hasher.reset();
+	}
+#endif
+
+	OnMemfdRequest(std::move(mapping), std::move(mail));
+}
+
+void
+QmqpServer::OnSocketReady(unsigned) noexcept
+try {
+	if (!event.IsReadPending()) {
+		/* the request has been received already; this is a
+		   HANGUP or ERROR event */
+		OnDisconnect();
+		return;
+	}
+
+	std::byte skip_buffer[16384];
+
+	std::span<std::byte> dest;
+	if (skip_remaining > 0)
+		dest = std::span{skip_buffer}.first(std::min(skip_remaining,
+							    sizeof(skip_buffer)));
+	else if (parser)
+		dest = std::span<std::byte>{payload.data(), payload.size()}.subspan(payload_fill);
+	else
+		dest = std::as_writable_bytes(std::span{header_buffer}).subspan(header_fill);
+
+	UniqueFileDescriptor memfd;
+
+	const auto nbytes = IsHeaderReceived() || header_fill > 0
+		? fd.Receive(dest, MSG_DONTWAIT)
+		: ReceiveFirst(dest, memfd);
+	if (nbytes < 0) {
+		if (errno == EAGAIN)
+			return;
+
+		throw MakeErrno("Failed to receive");
+	}
+
+	if (nbytes == 0) {
+		OnDisconnect();
+		return;
+	}
+
+	if (memfd.IsDefined()) {
+		if (nbytes != 1 ||
+		    dest.front() != static_cast<std::byte>(QMQP_MEMFD_MAGIC))
+			throw std::runtime_error{"Unexpected file descriptor"};
+
+		HandleMemfd(std::move(memfd));
+		return;
+	}
+
+	/* no timer rescheduling here; OnTimeout() looks at this
+	   time stamp */
+	last_receive = event.GetEventLoop().SteadyNow();
+
+	if (IsHeaderReceived())
+		payload_received += static_cast<std::size_t>(nbytes);
+
+	if (skip_remaining > 0) {
+		skip_remaining -= static_cast<std::size_t>(nbytes);
+		if (skip_remaining == 0)
+			Skipped();
+		return;
+	}
+
+	if (parser) {
+		payload_fill += static_cast<std::size_t>(nbytes);
+	} else {
+		header_fill += static_cast<std::size_t>(nbytes);
+		if (!ParseHeader())
+			return;
+
+		header_time = last_receive;
+		payload_received = parser ? payload_fill : 0;
+
+		if (!parser) {
+			/* declined by OnHeader() */
+			if (skip_remaining == 0)
+				Skipped();
+			return;
+		}
+	}
+
+	FeedParser();
+} catch (...) {
+	OnError(std::current_exception());
+}
+
+std::optional<QmqpReceiveTimeout>
+QmqpServer::CheckDeadlines(Event::TimePoint now) const noexcept
+{
+	if (!IsHeaderReceived() && now >= accept_time + limits.header_timeout)
+		return QmqpReceiveTimeout::HEADER;
+
+	if (now >= accept_time + limits.total_timeout)
+		return QmqpReceiveTimeout::TOTAL;
+
+	if (now >= last_receive + limits.idle_timeout)
+		return QmqpReceiveTimeout::IDLE;
+
+	if (limits.min_rate > 0 && IsHeaderReceived()) {
+		const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - header_time);
+		if (elapsed >= min_rate_grace &&
+		    payload_received * 1000 < limits.min_rate * static_cast<std::size_t>(elapsed.count()))
+			return QmqpReceiveTimeout::SLOW;
+	}
+
+	return std::nullopt;
+}
+
+void
+QmqpServer::ScheduleTimeout(Event::TimePoint now) noexcept
+{
+	auto deadline = std::min(accept_time + limits.total_timeout,
+				 last_receive + limits.idle_timeout);
+
+	if (!IsHeaderReceived())
+		deadline = std::min(deadline,
+				    accept_time + limits.header_timeout);
+	else if (limits.min_rate > 0)
+		deadline = std::min(deadline,
+				    std::max(header_time + min_rate_grace,
+					     now + min_rate_interval));
+
+	timeout_event.Schedule(deadline - now);
+}
+
+void
+QmqpServer::OnTimeout() noexcept
+{
+	const auto now = event.GetEventLoop().SteadyNow();
+
+	if (const auto reason = CheckDeadlines(now)) {
+		event.Cancel();
+		OnReceiveTimeout(*reason);
+		return;
+	}
+
+	/* the client has sent something since the timer was
+	   scheduled; check again at the next deadline */
+	ScheduleTimeout(now);
+}
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "QmqpReceiveLimits.hxx"
+#include "SealedMemfd.hxx"
+#include "djb/QmqpParser.hxx"
+#include "event/SocketEvent.hxx"
+#include "event/CoarseTimerEvent.hxx"
+#include "net/UniqueSocketDescriptor.hxx"
+#include "util/AllocatedArray.hxx"
+#include "config.h"
+
+#ifdef HAVE_LIBSODIUM
+#include "BodyHasher.hxx"
+#endif
+
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <sys/types.h> // for ssize_t
+
+class UniqueFileDescriptor;
+
+/**
+ * A server for one QMQP request.  Unlike #NetstringServer, it does
+ * not wait for the whole netstring to arrive before parsing it: the
+ * payload is fed into a #QmqpParser while it is being received, so
+ * malformed requests are rejected early and the envelope is ready
+ * as soon as the last byte arrives.
+ *
+ * All deadlines from #QmqpReceiveLimits are checked by one
+ * #CoarseTimerEvent (i.e. the #EventLoop's timer wheel).  Receiving
+ * data only updates #last_receive; the timer is not rescheduled for
+ * each read, but only when it fires before a deadline has been
+ * reached.
+ *
+ * Local clients may instead pass the payload in a sealed memfd (see
+ * QmqpMemfd.hxx); it is mapped and parsed in place, and
+ * OnMemfdRequest() is called instead of OnRequest().
+ */
+class QmqpServer {
+	UniqueSocketDescriptor fd;
+
+	SocketEvent event;
+
+	CoarseTimerEvent timeout_event;
+
+	const std::size_t max_size;
+
+	const QmqpReceiveLimits &limits;
+
+	const Event::TimePoint accept_time;
+
+	/**
+	 * When the netstring header was received completely.
+	 */
+	Event::TimePoint header_time;
+
+	/**
+	 * When data was last received from the client.
+	 */
+	Event::TimePoint last_receive;
+
+	/**
+	 * The number of bytes received after the netstring header.
+	 */
+	std::size_t payload_received = 0;
+
+	/**
+	 * The header of the outer netstring ("LENGTH:").
+	 */
+	char header_buffer[16];
+	std::size_t header_fill = 0;
+
+	/**
+	 * The payload of the outer netstring plus its trailing
+	 * comma.  It is allocated after the header has been
+	 * received.
+	 */
+	AllocatedArray<std::byte> payload;
+	std::size_t payload_fill = 0;
+
+	/**
+	 * The number of payload bytes (including the trailing comma)
+	 * which still need to be received and discarded after
+	 * OnHeader() has returned false.
+	 */
+	std::size_t skip_remaining = 0;
+
+	/**
+	 * If set, the rest of the payload is being skipped because
+	 * the #parser has already rejected the request; when it has
+	 * been received, OnBadRequest() is called with this result
+	 * instead of OnSkipped().
+	 */
+	std::optional<QmqpMail::ParseResult> bad_request;
+
+	std::optional<QmqpParser> parser;
+
+#ifdef HAVE_LIBSODIUM
+	/**
+	 * Calculates the hash of the message body while it is being
+	 * received (only if EnableBodyHash() has been called).
+	 */
+	std::optional<BodyHasher> body_hasher;
+
+	/**
+	 * The result of #body_hasher, available in OnRequest().
+	 */
+	std::optional<BodyHash> body_hash;
+#endif
+
+public:
+	/**
+	 * @param _limits must remain valid as long as this object
+	 */
+	QmqpServer(EventLoop &event_loop, UniqueSocketDescriptor &&_fd,
+		   std::size_t _max_size,
+		   const QmqpReceiveLimits &_limits) noexcept;
+	virtual ~QmqpServer() noexcept;
+
+	QmqpServer(const QmqpServer &) = delete;
+	QmqpServer &operator=(const QmqpServer &) = delete;
+
+	SocketDescriptor GetSocket() const noexcept {
+		return fd;
+	}
+
+protected:
+#ifdef HAVE_LIBSODIUM
+	/**
+	 * Calculate the #BodyHash of the message while it is being
+	 * received.  Must be called before the payload is received
+	 * (e.g. from the constructor or from OnHeader()).
+	 */
+	void EnableBodyHash() noexcept {
+		body_hasher.emplace();
+	}
+
+	/**
+	 * Obtain the #BodyHash (only in OnRequest()).
+	 *
+	 * @return the hash or nullptr if EnableBodyHash() has not
+	 * been called
+	 */
+	const BodyHash *GetBodyHash() const noexcept {
+		return body_hash ? &*body_hash : nullptr;
+	}
+#endif
+
+	/**
+	 * Send the response to the client.
+	 *
+	 * @return true on success, false on error (after
+	 * OnError() has been called)
+	 */
+	bool SendResponse(std::string_view response) noexcept;
+
+	/**
+	 * The header of the outer netstring has been received (and
+	 * the size has been checked against the configured maximum),
+	 * but no payload has been processed yet.
+	 *
+	 * @param size the announced payload size
+	 * @return true to receive and parse the request, false to
+	 * discard the payload without buffering or parsing it;
+	 * OnSkipped() will be called after it has been received
+	 */
+	virtual bool OnHeader(std::size_t size) noexcept = 0;
+
+	/**
+	 * The payload of a request which was declined by OnHeader()
+	 * has been received completely.  The method shall send a
+	 * response.
+	 */
+	virtual void OnSkipped() noexcept = 0;
+
+	/**
+	 * The request has been received and parsed successfully.
+	 *
+	 * Exceptions thrown by this method are passed to
+	 * OnError().
+	 *
+	 * @param _payload the QMQP payload which @p mail points into
+	 */
+	virtual void OnRequest(AllocatedArray<std::byte> &&_payload,
+			       QmqpMail &&mail) = 0;
+
+	/**
+	 * Like OnRequest(), but the payload was submitted in a
+	 * sealed memfd.
+	 *
+	 * @param memfd the mapped QMQP payload which @p mail points
+	 * into
+	 */
+	virtual void OnMemfdRequest(SealedMemfd &&memfd,
+				    QmqpMail &&mail) = 0;
+
+	/**
+	 * The parser has rejected the request.  If that happened
+	 * before it was received completely, the rest is received
+	 * and discarded first, so the client does not get an error
+	 * while it is still sending.  Receiving is stopped; the
+	 * method shall send an error response.
+	 */
+	virtual void OnBadRequest(QmqpMail::ParseResult result) noexcept = 0;
+
+	/**
+	 * The client has failed to send the request in time (see
+	 * #QmqpReceiveLimits).  Receiving is stopped; the method
+	 * shall close the connection.
+	 */
+	virtual void OnReceiveTimeout(QmqpReceiveTimeout reason) noexcept = 0;
+
+	virtual void OnError(std::exception_ptr error) noexcept = 0;
+	virtual void OnDisconnect() noexcept = 0;
+
+private:
+	/**
+	 * Parse the outer netstring header and allocate the
+	 * #payload buffer (unless OnHeader() has declined the
+	 * request).  Throws on error.
+	 *
+	 * @return false if the header is not yet complete
+	 */
+	bool ParseHeader();
+
+	void Skipped() noexcept;
+
+	/**
+	 * Receive the first bytes of a request.  Unlike later
+	 * reads, this accepts a memfd passed with SCM_RIGHTS.
+	 *
+	 * @param memfd_r receives the memfd (if one was passed)
+	 * @return the number of bytes received or -1 on error
+	 * (errno is set)
+	 */
+	ssize_t ReceiveFirst(std::span<std::byte> dest,
+			     UniqueFileDescriptor &memfd_r);
+
+	/**
+	 * A memfd has been received; map, parse and handle it.
+	 * Throws on error.
+	 */
+	void HandleMemfd(UniqueFileDescriptor &&memfd);
+
+	bool IsHeaderReceived() const noexcept {
+		return parser || skip_remaining > 0;
+	}
+
+	/**
+	 * Check all deadlines.
+	 *
+	 * @return the deadline which has been exceeded or nullopt
+	 */
+	std::optional<QmqpReceiveTimeout> CheckDeadlines(Event::TimePoint now) const noexcept;
+
+	/**
+	 * Schedule #timeout_event for the next deadline.
+	 */
+	void ScheduleTimeout(Event::TimePoint now) noexcept;
+
+	/**
+	 * Feed newly received payload into the #parser and invoke
+	 * the handler if a result is available.
+	 */
+	void FeedParser();
+
+	void OnSocketReady(unsigned events) noexcept;
+	void OnTimeout() noexcept;
+};
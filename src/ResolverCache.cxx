@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "ResolverCache.hxx"
+#include "event/Loop.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+#include "net/AddressInfo.hxx"
+#include "net/Resolver.hxx"
+#include "system/Error.hxx"
+#include "util/Exception.hxx"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/eventfd.h>
+
+struct ResolverCache::Result {
+	std::string host;
+	std::vector<AllocatedSocketAddress> addresses;
+	std::string error;
+};
+
+struct ResolverCache::Shared {
+	/**
+	 * Helper threads which have been idle for this long exit.
+	 */
+	static constexpr auto IDLE_TIMEOUT = std::chrono::minutes{1};
+
+	/**
+	 * An eventfd which is signalled by the helper threads.
+	 */
+	UniqueFileDescriptor event_fd;
+
+	/**
+	 * Protects all other fields.
+	 */
+	std::mutex mutex;
+	std::condition_variable cond;
+
+	std::deque<std::string> requests;
+	std::deque<Result> results;
+
+	/**
+	 * The number of helper threads and how many of them are
+	 * waiting for a request.
+	 */
+	unsigned n_threads = 0, n_idle = 0;
+
+	bool stop = false;
+};
+
+ResolverCache::ResolverCache(EventLoop &_event_loop)
+	:event_loop(_event_loop),
+	 shared(std::make_shared<Shared>()),
+	 event(event_loop, BIND_THIS_METHOD(OnEventReady))
+{
+	const int fd = eventfd(0, EFD_NONBLOCK|EFD_CLOEXEC);
+	if (fd < 0)
+		throw MakeErrno("eventfd() failed");
+
+	shared->event_fd = UniqueFileDescriptor{fd};
+
+	/* the helper threads may outlive us (see Disable()), so
+	   they get their own copy */
+	const int dup_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+	if (dup_fd < 0)
+		throw MakeErrno("Failed to duplicate eventfd");
+
+	event.Open(FileDescriptor{dup_fd});
+	event.ScheduleRead();
+}
+
+ResolverCache::~ResolverCache() noexcept
+{
+	Disable();
+}
+
+void
+ResolverCache::Disable() noexcept
+{
+	if (!event.IsDefined())
+		return;
+
+	{
+		const std::scoped_lock lock{shared->mutex};
+		shared->stop = true;
+		shared->requests.clear();
+	}
+
+	/* don't wait for the helper threads: a getaddrinfo() call
+	   may take a long time; they exit as soon as it returns */
+	shared->cond.notify_all();
+
+	event.Close();
+}
+
+ResolverCache::Entry *
+ResolverCache::Get(std::string_view host, ResolverWaiter &waiter) noexcept
+{
+	const auto now = event_loop.SteadyNow();
+
+	auto i = entries.find(host);
+	if (i == entries.end()) {
+		if (entries.size() >= SWEEP_THRESHOLD)
+			Sweep(now);
+
+		i = entries.try_emplace(std::string{host}).first;
+	}
+
+	auto &entry = i->second;
+
+	if (entry.IsDefined() && now < entry.expires) {
+		++n_hits;
+
+		/* refresh names which are still in use before they
+		   expire */
+		if (entry.HasAddress() && !entry.pending &&
+		    now >= entry.expires - ttl / 4) {
+			++n_refreshes;
+			Enqueue(i->first, entry);
+		}
+
+		return &entry;
+	}
+
+	++n_misses;
+
+	entry.waiters.push_back(waiter);
+	if (!entry.pending)
+		Enqueue(i->first, entry);
+
+	return nullptr;
+}
+
+void
+ResolverCache::Enqueue(std::string_view host, Entry &entry) noexcept
+{
+	if (!event.IsDefined())
+		/* disabled */
+		return;
+
+	entry.pending = true;
+
+	bool spawn;
+
+	{
+		const std::scoped_lock lock{shared->mutex};
+		shared->requests.emplace_back(host);
+
+		/* start another helper thread on demand if all
+		   existing ones are busy */
+		spawn = shared->requests.size() > shared->n_idle &&
+			shared->n_threads < MAX_THREADS;
+		if (spawn)
+			++shared->n_threads;
+	}
+
+	if (spawn)
+		std::thread{&ResolverCache::Run, shared}.detach();
+	else
+		shared->cond.notify_one();
+}
+
+void
+ResolverCache::Sweep(Event::TimePoint now) noexcept
+{
+	std::erase_if(entries, [now](const auto &i){
+		const auto &entry = i.second;
+		return !entry.pending && entry.waiters.empty() &&
+			now >= entry.expires;
+	});
+}
+
+void
+ResolverCache::Run(std::shared_ptr<Shared> shared) noexcept
+{
+	static constexpr struct addrinfo hints{
+		.ai_flags = AI_ADDRCONFIG,
+		.ai_family = AF_UNSPEC,
+		.ai_socktype = SOCK_STREAM,
+	};
+
+	auto &s = *shared;
+
+	std::unique_lock lock{s.mutex};
+
+	while (true) {
+		++s.n_idle;
+		const bool ready = s.cond.wait_for(lock, Shared::IDLE_TIMEOUT, [&s]{
+			return s.stop || !s.requests.empty();
+		});
+		--s.n_idle;
+
+		if (!ready || s.stop)
+			break;
+
+		Result result{.host = std::move(s.requests.front())};
+		s.requests.pop_front();
+
+		lock.unlock();
+
+		try {
+			const auto ai = Resolve(result.host.c_str(), 628, &hints);
+			for (const auto &i : ai)
+				result.addresses.emplace_back(i);
+		} catch (...) {
+			result.error = GetFullMessage(std::current_exception());
+		}
+
+		lock.lock();
+
+		if (s.stop)
+			/* the ResolverCache has been disabled while
+			   we were resolving */
+			break;
+
+		s.results.emplace_back(std::move(result));
+
+		static constexpr uint64_t one = 1;
+		(void)s.event_fd.Write(std::as_bytes(std::span{&one, 1}));
+	}
+
+	--s.n_threads;
+}
+
+inline void
+ResolverCache::OnEventReady(unsigned) noexcept
+{
+	uint64_t value;
+	(void)event.GetFileDescriptor().Read(std::as_writable_bytes(std::span{&value, 1}));
+
+	std::deque<Result> r;
+
+	{
+		const std::scoped_lock lock{shared->mutex};
+		r.swap(shared->results);
+	}
+
+	const auto now = event_loop.SteadyNow();
+
+	for (auto &result : r) {
+		auto i = entries.find(result.host);
+		if (i == entries.end())
+			continue;
+
+		auto &entry = i->second;
+		entry.pending = false;
+
+		if (!result.addresses.empty()) {
+			entry.addresses = std::move(result.addresses);
+			entry.next = 0;
+			entry.error.clear();
+			entry.expires = now + ttl;
+		} else {
+			++n_errors;
+
+			if (!entry.HasAddress() || now >= entry.expires) {
+				entry.addresses.clear();
+				entry.error = std::move(result.error);
+				entry.expires = now + NEGATIVE_TTL;
+			}
+
+			/* else: a background refresh has failed;
+			   keep using the old address until it
+			   expires */
+		}
+
+		/* the callbacks may resume Lua coroutines which may
+		   call Get() again; unordered_map never invalidates
+		   references to its elements on insertion */
+		while (!entry.waiters.empty()) {
+			auto &waiter = entry.waiters.front();
+			entry.waiters.pop_front();
+
+			if (entry.HasAddress())
+				waiter.OnResolved(entry.NextAddress());
+			else
+				waiter.OnResolverError(entry.error);
+		}
+	}
+}
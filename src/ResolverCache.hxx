@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "event/Chrono.hxx"
+#include "event/PipeEvent.hxx"
+#include "net/AllocatedSocketAddress.hxx"
+#include "util/IntrusiveList.hxx"
+
+#include <cassert>
+#include <cstdint>
+#include <functional> // for std::equal_to
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Waits for a #ResolverCache lookup to complete.  Destroying it
+ * cancels the wait.
+ */
+class ResolverWaiter : public AutoUnlinkIntrusiveListHook {
+public:
+	virtual void OnResolved(SocketAddress address) noexcept = 0;
+
+	/**
+	 * @param error a human-readable error message
+	 */
+	virtual void OnResolverError(std::string_view error) noexcept = 0;
+};
+
+/**
+ * Resolves host names (with optional port) to QMQP server addresses
+ * without blocking the #EventLoop: getaddrinfo() runs on a small pool
+ * of helper threads (so one slow name does not delay all others)
+ * which report completion through an eventfd.
+ *
+ * All addresses of a name are kept; they are handed out in a
+ * round-robin fashion.
+ *
+ * Results are cached for a fixed time (getaddrinfo() does not
+ * report the DNS TTL).  Entries which are used during the last
+ * quarter of their lifetime are refreshed in the background, so
+ * popular names never expire while in use.  Errors are cached for
+ * a few seconds.
+ */
+class ResolverCache {
+public:
+	struct Entry {
+		/**
+		 * The addresses returned by the last successful
+		 * lookup.
+		 */
+		std::vector<AllocatedSocketAddress> addresses;
+
+		/**
+		 * The index of the address in #addresses which will
+		 * be returned by the next NextAddress() call.
+		 */
+		std::size_t next = 0;
+
+		/**
+		 * The error message of the last failed lookup (if
+		 * #addresses is empty).
+		 */
+		std::string error;
+
+		Event::TimePoint expires;
+
+		IntrusiveList<ResolverWaiter> waiters;
+
+		/**
+		 * Has this name been queued for the helper thread?
+		 */
+		bool pending = false;
+
+		bool IsDefined() const noexcept {
+			return HasAddress() || !error.empty();
+		}
+
+		bool HasAddress() const noexcept {
+			return !addresses.empty();
+		}
+
+		/**
+		 * Return one of the addresses, rotating through all
+		 * of them.
+		 */
+		SocketAddress NextAddress() noexcept {
+			assert(HasAddress());
+
+			const SocketAddress result = addresses[next];
+			next = (next + 1) % addresses.size();
+			return result;
+		}
+	};
+
+private:
+	static constexpr Event::Duration NEGATIVE_TTL = std::chrono::seconds{5};
+
+	/**
+	 * The maximum number of helper threads.
+	 */
+	static constexpr unsigned MAX_THREADS = 4;
+
+	/**
+	 * If the cache grows larger than this, expired entries are
+	 * removed.
+	 */
+	static constexpr std::size_t SWEEP_THRESHOLD = 1024;
+
+	struct Hash {
+		using is_transparent = void;
+
+		std::size_t operator()(std::string_view s) const noexcept {
+			return std::hash<std::string_view>{}(s);
+		}
+	};
+
+	struct Result;
+	struct Shared;
+
+	EventLoop &event_loop;
+
+	/**
+	 * The state shared with the helper threads.  It is
+	 * reference-counted because Disable() does not wait for
+	 * them (they may be blocked in getaddrinfo() for a long
+	 * time).
+	 */
+	const std::shared_ptr<Shared> shared;
+
+	/**
+	 * An eventfd which is signalled by the helper threads (a
+	 * duplicate of Shared::event_fd).
+	 */
+	PipeEvent event;
+
+	Event::Duration ttl = std::chrono::minutes{1};
+
+	std::unordered_map<std::string, Entry, Hash, std::equal_to<>> entries;
+
+	uint_least64_t n_hits = 0, n_misses = 0, n_refreshes = 0,
+		n_errors = 0;
+
+public:
+	/**
+	 * Throws on error.
+	 */
+	explicit ResolverCache(EventLoop &_event_loop);
+	~ResolverCache() noexcept;
+
+	ResolverCache(const ResolverCache &) = delete;
+	ResolverCache &operator=(const ResolverCache &) = delete;
+
+	void SetTtl(Event::Duration _ttl) noexcept {
+		ttl = _ttl;
+	}
+
+	/**
+	 * Tell the helper threads to exit and unregister the
+	 * eventfd.  This does not wait for lookups which are in
+	 * progress; their results are discarded.  Pending waiters
+	 * will never be invoked.
+	 */
+	void Disable() noexcept;
+
+	/**
+	 * Look up a host name in the cache.  If it is not cached (or
+	 * has expired), the name is queued for resolving and
+	 * @p waiter will be invoked later.
+	 *
+	 * @param host a host name or address, optionally with a port
+	 * (the default is the QMQP port 628)
+	 * @param waiter invoked later if the return value is
+	 * nullptr (unless it is destroyed before that)
+	 * @return the cache entry (with either addresses or an
+	 * error message) or nullptr if @p waiter has been registered
+	 */
+	Entry *Get(std::string_view host, ResolverWaiter &waiter) noexcept;
+
+	std::size_t size() const noexcept {
+		return entries.size();
+	}
+
+	uint_least64_t GetHits() const noexcept {
+		return n_hits;
+	}
+
+	uint_least64_t GetMisses() const noexcept {
+		return n_misses;
+	}
+
+	uint_least64_t GetRefreshes() const noexcept {
+		return n_refreshes;
+	}
+
+	uint_least64_t GetErrors() const noexcept {
+		return n_errors;
+	}
+
+private:
+	void Enqueue(std::string_view host, Entry &entry) noexcept;
+	void Sweep(Event::TimePoint now) noexcept;
+
+	static void Run(std::shared_ptr<Shared> shared) noexcept;
+
+	void OnEventReady(unsigned events) noexcept;
+};
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "SealedMemfd.hxx"
+#include "QmqpMemfd.hxx"
+#include "io/FileDescriptor.hxx"
+#include "system/Error.hxx"
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+std::size_t
+CheckSealedMemfd(FileDescriptor fd)
+{
+	/* this fails with EINVAL if the file does not support seals
+	   (i.e. it is not a memfd) */
+	const int seals = fcntl(fd.Get(), F_GET_SEALS);
+	if (seals < 0)
+		throw MakeErrno("Not a sealed memfd");
+
+	if ((seals & QMQP_MEMFD_REQUIRED_SEALS) != QMQP_MEMFD_REQUIRED_SEALS)
+		throw std::runtime_error{"The memfd is not sealed"};
+
+	struct stat st;
+	if (fstat(fd.Get(), &st) < 0)
+		throw MakeErrno("Failed to stat the memfd");
+
+	if (!S_ISREG(st.st_mode))
+		throw std::runtime_error{"Not a regular file"};
+
+	return static_cast<std::size_t>(st.st_size);
+}
+
+SealedMemfd::SealedMemfd(FileDescriptor fd, std::size_t _size)
+	:size(_size)
+{
+	/* F_SEAL_WRITE rules out writable shared mappings, so this
+	   read-only shared mapping sees exactly what was checked */
+	void *p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.Get(), 0);
+	if (p == MAP_FAILED)
+		throw MakeErrno("Failed to map the memfd");
+
+	/* the mail will be parsed from the beginning to the end and
+	   then relayed the same way */
+	madvise(p, size, MADV_SEQUENTIAL);
+
+	data = static_cast<const std::byte *>(p);
+}
+
+SealedMemfd::~SealedMemfd() noexcept
+{
+	if (data != nullptr)
+		munmap(const_cast<std::byte *>(data), size);
+}
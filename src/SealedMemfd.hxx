@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+class FileDescriptor;
+
+/**
+ * Check whether the given file descriptor is a memfd with the seals
+ * required by the memfd submission protocol (see QmqpMemfd.hxx).
+ * Throws on error.
+ *
+ * @return the size of the file
+ */
+std::size_t
+CheckSealedMemfd(FileDescriptor fd);
+
+/**
+ * A read-only mapping of a sealed memfd.  Since the memfd cannot be
+ * modified or shrunk, the mapping can be used like a private buffer.
+ */
+class SealedMemfd {
+	const std::byte *data = nullptr;
+	std::size_t size = 0;
+
+public:
+	SealedMemfd() noexcept = default;
+
+	/**
+	 * Map the memfd.  Throws on error.
+	 *
+	 * @param fd a memfd which has been checked with
+	 * CheckSealedMemfd(); it may be closed after this call
+	 * @param _size the size returned by CheckSealedMemfd(); must
+	 * not be zero
+	 */
+	SealedMemfd(FileDescriptor fd, std::size_t _size);
+
+	SealedMemfd(SealedMemfd &&src) noexcept
+		:data(std::exchange(src.data, nullptr)),
+		 size(std::exchange(src.size, 0)) {}
+
+	~SealedMemfd() noexcept;
+
+	SealedMemfd &operator=(SealedMemfd &&src) noexcept {
+		using std::swap;
+		swap(data, src.data);
+		swap(size, src.size);
+		return *this;
+	}
+
+	operator std::span<const std::byte>() const noexcept {
+		return {data, size};
+	}
+
+	std::size_t GetSize() const noexcept {
+		return size;
+	}
+};
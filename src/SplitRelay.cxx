@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "SplitRelay.hxx"
+#include "Action.hxx"
+#include "RemoteRelay.hxx"
+#include "ExecRelay.hxx"
+#include "RawExecRelay.hxx"
+
+#include <fmt/format.h>
+
+#include <cassert>
+#include <utility> // for std::unreachable()
+
+using std::string_view_literals::operator""sv;
+
+/**
+ * Generate the recipient list of a group.
+ */
+static std::vector<std::string_view>
+SelectRecipients(const QmqpMail &src,
+		 std::span<const std::size_t> recipients) noexcept
+{
+	std::vector<std::string_view> result;
+	result.reserve(recipients.size());
+
+	for (const auto i : recipients) {
+		assert(i < src.recipients.size());
+		result.push_back(src.recipients[i]);
+	}
+
+	return result;
+}
+
+SplitRelay::Group::Group(SplitRelay &_parent, const QmqpMail &src,
+			 std::span<const std::size_t> recipients) noexcept
+	:parent(_parent),
+	 timeout(parent.event_loop, BIND_THIS_METHOD(OnTimeout))
+{
+	mail.message = src.message;
+	mail.sender = src.sender;
+	mail.recipients = SelectRecipients(src, recipients);
+
+	tail = GenerateQmqpTail(mail.recipients);
+	mail.tail = tail;
+}
+
+void
+SplitRelay::Group::Start(const Action &action,
+			 std::list<std::span<const std::byte>> &&headers) noexcept
+try {
+	if (action.timeout.count() > 0)
+		timeout.Schedule(action.timeout);
+
+	switch (action.type) {
+	case Action::Type::DISCARD:
+		Finish("Kdiscarded"sv);
+		break;
+
+	case Action::Type::REJECT:
+		Finish("Drejected"sv);
+		break;
+
+	case Action::Type::CONNECT:
+		{
+			auto *relay = new RemoteRelay(parent.event_loop,
+						      mail, std::move(headers),
+						      *this);
+			relay_operation = ToDeletePointer(relay);
+			relay->Start(action.connect);
+		}
+		break;
+
+	case Action::Type::EXEC:
+		{
+			auto *relay = new ExecRelay(parent.event_loop,
+						    parent.child_process_terminator,
+						    mail, std::move(headers),
+						    *this);
+			relay_operation = ToDeletePointer(relay);
+			relay->Start(action);
+		}
+		break;
+
+	case Action::Type::EXEC_RAW:
+		{
+			auto *relay = new RawExecRelay(parent.event_loop,
+						       parent.child_process_terminator,
+						       mail, std::move(headers),
+						       *this);
+			relay_operation = ToDeletePointer(relay);
+			relay->Start(action);
+		}
+		break;
+
+	case Action::Type::UNDEFINED:
+	case Action::Type::FANOUT:
+	case Action::Type::SPLIT:
+		/* rejected by the Lua method split() */
+		assert(false);
+		std::unreachable();
+	}
+} catch (...) {
+	parent.logger(1, std::current_exception());
+	Finish("Zinternal server error"sv);
+}
+
+void
+SplitRelay::Group::Finish(std::string_view _response) noexcept
+{
+	assert(response.empty());
+	assert(!_response.empty());
+
+	/* copy the response before destroying the relay which owns
+	   it */
+	response = _response;
+
+	timeout.Cancel();
+	relay_operation = {};
+
+	parent.logger(response.front() == 'K' ? 4 : 2,
+		      fmt::format("{} recipients: {}"sv,
+				  GetRecipientCount(), response).c_str());
+
+	parent.OnGroupFinished();
+}
+
+void
+SplitRelay::Group::OnTimeout() noexcept
+{
+	Finish("Ztimeout"sv);
+}
+
+void
+SplitRelay::Group::OnRelayResponse(std::string_view _response) noexcept
+{
+	Finish(_response);
+}
+
+void
+SplitRelay::Group::OnRelayError(std::string_view _response,
+				std::exception_ptr error) noexcept
+{
+	parent.logger(1, error);
+	Finish(_response);
+}
+
+SplitRelay::SplitRelay(EventLoop &_event_loop,
+		       ChildProcessTerminator &_child_process_terminator,
+		       const LoggerBase &parent_logger,
+		       RelayHandler &_handler) noexcept
+	:event_loop(_event_loop),
+	 child_process_terminator(_child_process_terminator),
+	 logger(parent_logger, "split"),
+	 handler(_handler)
+{
+}
+
+void
+SplitRelay::Start(const Action &action, const QmqpMail &mail,
+		  const std::list<std::span<const std::byte>> &headers) noexcept
+{
+	assert(action.type == Action::Type::SPLIT);
+	assert(!action.actions.empty());
+	assert(groups.empty());
+
+	/* create all groups before starting any of them, so
+	   OnGroupFinished() can count them */
+	auto g = groups.before_begin();
+	for (const auto &i : action.actions) {
+		g = groups.emplace_after(g, *this, mail, i.recipients);
+		++n_pending;
+	}
+
+	/* groups which finish right away must not submit the
+	   response while we're still iterating */
+	starting = true;
+
+	auto a = action.actions.begin();
+	for (auto &i : groups)
+		i.Start(*a++, std::list<std::span<const std::byte>>{headers});
+
+	starting = false;
+
+	if (n_pending == 0)
+		/* this may destroy this object */
+		Finish();
+}
+
+inline void
+SplitRelay::OnGroupFinished() noexcept
+{
+	assert(n_pending > 0);
+
+	if (--n_pending == 0 && !starting)
+		Finish();
+}
+
+/**
+ * How bad is this QMQP response?  Higher values are worse.
+ */
+static constexpr unsigned
+GetSeverity(std::string_view response) noexcept
+{
+	switch (response.front()) {
+	case 'K':
+		return 0;
+
+	case 'D':
+		return 1;
+
+	default:
+		return 2;
+	}
+}
+
+void
+SplitRelay::Finish() noexcept
+{
+	assert(n_pending == 0);
+	assert(!groups.empty());
+
+	const Group *worst = nullptr;
+	for (const auto &i : groups)
+		if (worst == nullptr ||
+		    GetSeverity(i.GetResponse()) > GetSeverity(worst->GetResponse()))
+			worst = &i;
+
+	handler.OnRelayResponse(worst->GetResponse());
+}
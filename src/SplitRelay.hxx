@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "Handler.hxx"
+#include "djb/QmqpMail.hxx"
+#include "io/Logger.hxx"
+#include "event/CoarseTimerEvent.hxx"
+#include "util/DisposablePointer.hxx"
+
+#include <cstddef>
+#include <forward_list>
+#include <list>
+#include <span>
+#include <string>
+
+struct Action;
+class ChildProcessTerminator;
+
+/**
+ * Relays a mail to several destinations, each one with a different
+ * subset of the recipients (a "split" action).  The groups are
+ * relayed concurrently, and when all of them are finished, the
+ * #RelayHandler receives one combined response: the "worst" one,
+ * where "Z" (temporary failure) is worse than "D" (permanent
+ * failure) which is worse than "K" (accepted); of several responses
+ * with the same code, the first group wins.
+ */
+class SplitRelay final {
+	class Group final : RelayHandler {
+		SplitRelay &parent;
+
+		/**
+		 * The #QmqpMail::tail for the recipients of this
+		 * group.
+		 */
+		std::string tail;
+
+		/**
+		 * A copy of the original mail with the recipient list
+		 * of this group.
+		 */
+		QmqpMail mail;
+
+		DisposablePointer relay_operation;
+
+		CoarseTimerEvent timeout;
+
+		/**
+		 * The response of the destination; empty while the
+		 * relay is still running.
+		 */
+		std::string response;
+
+	public:
+		Group(SplitRelay &_parent, const QmqpMail &src,
+		      std::span<const std::size_t> recipients) noexcept;
+
+		Group(const Group &) = delete;
+		Group &operator=(const Group &) = delete;
+
+		std::size_t GetRecipientCount() const noexcept {
+			return mail.recipients.size();
+		}
+
+		std::string_view GetResponse() const noexcept {
+			return response;
+		}
+
+		void Start(const Action &action,
+			   std::list<std::span<const std::byte>> &&headers) noexcept;
+
+	private:
+		void Finish(std::string_view _response) noexcept;
+
+		void OnTimeout() noexcept;
+
+		/* virtual methods from class RelayHandler */
+		void OnRelayResponse(std::string_view response) noexcept override;
+		void OnRelayError(std::string_view response,
+				  std::exception_ptr error) noexcept override;
+	};
+
+	EventLoop &event_loop;
+	ChildProcessTerminator &child_process_terminator;
+
+	const ChildLogger logger;
+
+	RelayHandler &handler;
+
+	std::forward_list<Group> groups;
+
+	/**
+	 * The number of groups which have not finished yet.
+	 */
+	std::size_t n_pending = 0;
+
+	/**
+	 * Set while Start() runs; if all groups finish during that
+	 * time, Start() submits the response.
+	 */
+	bool starting = false;
+
+public:
+	[[nodiscard]]
+	SplitRelay(EventLoop &_event_loop,
+		   ChildProcessTerminator &_child_process_terminator,
+		   const LoggerBase &parent_logger,
+		   RelayHandler &_handler) noexcept;
+
+	auto &GetEventLoop() const noexcept {
+		return event_loop;
+	}
+
+	/**
+	 * Start relaying.  This object may be destroyed (by the
+	 * #RelayHandler) before this method returns.
+	 *
+	 * @param action a #SPLIT action whose recipient indexes
+	 * refer to this mail
+	 * @param headers the additional headers to be inserted in
+	 * all copies
+	 */
+	void Start(const Action &action, const QmqpMail &mail,
+		   const std::list<std::span<const std::byte>> &headers) noexcept;
+
+private:
+	void OnGroupFinished() noexcept;
+
+	/**
+	 * Submit the combined response to the #RelayHandler.
+	 */
+	void Finish() noexcept;
+};
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+/*
+ * A small QMQP client which submits a mail to qrelay in a sealed
+ * memfd.  The message is read from stdin; the sender and the
+ * recipients are specified on the command line.  The exit status
+ * follows qmail-qmqpc: 0 on success, 100 on permanent and 111 on
+ * temporary failure.
+ */
+
+#include "MemfdSubmit.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "net/LocalSocketAddress.hxx"
+#include "net/UniqueSocketDescriptor.hxx"
+#include "util/PrintException.hxx"
+
+#include <fmt/core.h>
+
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+using std::string_view_literals::operator""sv;
+
+static constexpr int EXIT_PERMANENT = 100;
+static constexpr int EXIT_TEMPORARY = 111;
+
+static UniqueSocketDescriptor
+Connect(const char *path)
+{
+	UniqueSocketDescriptor s;
+	if (!s.Create(AF_LOCAL, SOCK_STREAM, 0))
+		throw FmtErrno("Failed to create socket");
+
+	if (!s.Connect(LocalSocketAddress{path}))
+		throw FmtErrno("Failed to connect to {}", path);
+
+	return s;
+}
+
+int
+main(int argc, char **argv) noexcept
+try {
+	if (argc < 4) {
+		fmt::print(stderr, "Usage: {} SOCKET SENDER RECIPIENT...\n"sv,
+			   argv[0]);
+		return EXIT_PERMANENT;
+	}
+
+	const char *const socket_path = argv[1];
+	const std::string_view sender = argv[2];
+	const std::vector<std::string_view> recipients{argv + 3, argv + argc};
+
+	const auto memfd = CreateQmqpMemfd(FileDescriptor{STDIN_FILENO},
+					   sender, recipients);
+	const auto response = SubmitQmqpMemfd(Connect(socket_path), memfd);
+
+	if (response.empty())
+		throw std::runtime_error{"Empty response"};
+
+	switch (response.front()) {
+	case 'K':
+		return EXIT_SUCCESS;
+
+	case 'D':
+		fmt::print(stderr, "{}\n"sv, std::string_view{response}.substr(1));
+		return EXIT_PERMANENT;
+
+	default:
+		fmt::print(stderr, "{}\n"sv, std::string_view{response}.substr(1));
+		return EXIT_TEMPORARY;
+	}
+} catch (...) {
+	PrintException(std::current_exception());
+	return EXIT_TEMPORARY;
+}
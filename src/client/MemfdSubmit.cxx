@@ -0,0 +1,288 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "MemfdSubmit.hxx"
+#include "QmqpMemfd.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "net/SocketDescriptor.hxx"
+#include "util/NumberParser.hxx"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring> // for std::memmove()
+#include <stdexcept>
+
+#include <errno.h>
+#include <fcntl.h> // for splice()
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using std::string_view_literals::operator""sv;
+
+static std::size_t
+NetstringSize(std::string_view value) noexcept
+{
+	return fmt::formatted_size("{}:"sv, value.size()) + value.size() + 1;
+}
+
+/**
+ * Write the whole buffer.  Throws on error.
+ */
+static void
+WriteFull(FileDescriptor fd, std::string_view src)
+{
+	while (!src.empty()) {
+		const auto nbytes = write(fd.Get(), src.data(), src.size());
+		if (nbytes < 0)
+			throw FmtErrno("Failed to write to memfd");
+
+		src.remove_prefix(static_cast<std::size_t>(nbytes));
+	}
+}
+
+static void
+WriteNetstring(FileDescriptor fd, std::string_view value)
+{
+	char header[32];
+	const char *header_end = fmt::format_to(header, "{}:"sv, value.size());
+
+	WriteFull(fd, {header, header_end});
+	WriteFull(fd, value);
+	WriteFull(fd, ","sv);
+}
+
+static UniqueFileDescriptor
+CreateMemfd()
+{
+	UniqueFileDescriptor fd{AdoptTag{},
+		memfd_create("qmqp", MFD_CLOEXEC|MFD_ALLOW_SEALING)};
+	if (!fd.IsDefined())
+		throw FmtErrno("memfd_create() failed");
+
+	return fd;
+}
+
+static void
+WriteEnvelope(FileDescriptor fd, std::string_view sender,
+	      std::span<const std::string_view> recipients)
+{
+	WriteNetstring(fd, sender);
+	for (const auto i : recipients)
+		WriteNetstring(fd, i);
+}
+
+static void
+AddMemfdSeals(FileDescriptor fd)
+{
+	/* the memfd is not mapped anymore, so sealing cannot fail
+	   with EBUSY */
+	if (fcntl(fd.Get(), F_ADD_SEALS,
+		  QMQP_MEMFD_REQUIRED_SEALS|F_SEAL_GROW|F_SEAL_SEAL) < 0)
+		throw FmtErrno("Failed to seal memfd");
+}
+
+UniqueFileDescriptor
+CreateQmqpMemfd(std::string_view message, std::string_view sender,
+		std::span<const std::string_view> recipients)
+{
+	auto fd = CreateMemfd();
+
+	std::size_t size = NetstringSize(message) + NetstringSize(sender);
+	for (const auto i : recipients)
+		size += NetstringSize(i);
+
+	/* allocate everything at once, so writing does not need to
+	   grow the file repeatedly */
+	if (ftruncate(fd.Get(), size) < 0)
+		throw FmtErrno("Failed to allocate memfd");
+
+	WriteNetstring(fd, message);
+	WriteEnvelope(fd, sender, recipients);
+	AddMemfdSeals(fd);
+	return fd;
+}
+
+/**
+ * Copy everything from @p src to the current position of @p dest.
+ * Throws on error.
+ *
+ * @return the number of bytes copied
+ */
+static std::size_t
+CopyAll(FileDescriptor dest, FileDescriptor src)
+{
+	std::size_t total = 0;
+
+	/* if the source is a pipe, splice() moves its buffers into
+	   the memfd without copying them to userspace */
+	while (true) {
+		const auto nbytes = splice(src.Get(), nullptr, dest.Get(), nullptr,
+					   1024 * 1024, SPLICE_F_MOVE);
+		if (nbytes < 0) {
+			if (errno == EINVAL && total == 0)
+				/* not a pipe; fall back to read() */
+				break;
+
+			throw FmtErrno("Failed to read the message");
+		}
+
+		if (nbytes == 0)
+			return total;
+
+		total += static_cast<std::size_t>(nbytes);
+	}
+
+	while (true) {
+		std::array<char, 65536> buffer;
+		const auto nbytes = read(src.Get(), buffer.data(), buffer.size());
+		if (nbytes < 0)
+			throw FmtErrno("Failed to read the message");
+
+		if (nbytes == 0)
+			return total;
+
+		WriteFull(dest, {buffer.data(), static_cast<std::size_t>(nbytes)});
+		total += static_cast<std::size_t>(nbytes);
+	}
+}
+
+UniqueFileDescriptor
+CreateQmqpMemfd(FileDescriptor message, std::string_view sender,
+		std::span<const std::string_view> recipients)
+{
+	/* the longest possible netstring header: 20 digits (64 bit)
+	   and the colon */
+	static constexpr std::size_t MAX_HEADER = 21;
+
+	auto fd = CreateMemfd();
+
+	/* the message length is not known until it has been read
+	   completely, so leave room for the netstring header and
+	   write the message right after it */
+	if (lseek(fd.Get(), MAX_HEADER, SEEK_SET) < 0)
+		throw FmtErrno("Failed to seek memfd");
+
+	const std::size_t message_size = CopyAll(fd, message);
+
+	WriteFull(fd, ","sv);
+	WriteEnvelope(fd, sender, recipients);
+
+	const auto end = lseek(fd.Get(), 0, SEEK_CUR);
+	if (end < 0)
+		throw FmtErrno("Failed to seek memfd");
+
+	char header_buffer[32];
+	const std::string_view header{
+		header_buffer,
+		fmt::format_to(header_buffer, "{}:"sv, message_size),
+	};
+
+	/* netstrings must not have leading zeroes, so the payload
+	   cannot begin with padding: fill in the header and move
+	   the rest down to close the gap */
+	const std::size_t gap = MAX_HEADER - header.size();
+	const std::size_t size = static_cast<std::size_t>(end) - gap;
+
+	void *p = mmap(nullptr, static_cast<std::size_t>(end),
+		       PROT_READ|PROT_WRITE, MAP_SHARED, fd.Get(), 0);
+	if (p == MAP_FAILED)
+		throw FmtErrno("Failed to map memfd");
+
+	auto *data = static_cast<char *>(p);
+	std::memmove(data + header.size(), data + MAX_HEADER,
+		     static_cast<std::size_t>(end) - MAX_HEADER);
+	std::copy(header.begin(), header.end(), data);
+	munmap(p, static_cast<std::size_t>(end));
+
+	if (ftruncate(fd.Get(), size) < 0)
+		throw FmtErrno("Failed to truncate memfd");
+
+	AddMemfdSeals(fd);
+	return fd;
+}
+
+static void
+SendMemfd(SocketDescriptor s, FileDescriptor memfd)
+{
+	static constexpr char magic = QMQP_MEMFD_MAGIC;
+	struct iovec iov{
+		.iov_base = const_cast<char *>(&magic),
+		.iov_len = sizeof(magic),
+	};
+
+	alignas(struct cmsghdr) std::array<std::byte, CMSG_SPACE(sizeof(int))> control{};
+
+	struct msghdr msg{
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+		.msg_control = control.data(),
+		.msg_controllen = control.size(),
+	};
+
+	struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+
+	const int value = memfd.Get();
+	std::copy_n(reinterpret_cast<const std::byte *>(&value),
+		    sizeof(value), reinterpret_cast<std::byte *>(CMSG_DATA(cmsg)));
+
+	if (sendmsg(s.Get(), &msg, MSG_NOSIGNAL) < 0)
+		throw FmtErrno("Failed to send memfd");
+}
+
+/**
+ * Receive the response netstring.  Throws on error.
+ */
+static std::string
+ReceiveResponse(SocketDescriptor s)
+{
+	char buffer[1024];
+	std::size_t fill = 0;
+
+	while (true) {
+		if (fill >= sizeof(buffer))
+			throw std::runtime_error{"Response is too long"};
+
+		const auto nbytes = recv(s.Get(), buffer + fill,
+					 sizeof(buffer) - fill, 0);
+		if (nbytes < 0)
+			throw FmtErrno("Failed to receive response");
+
+		if (nbytes == 0)
+			throw std::runtime_error{"Connection closed prematurely"};
+
+		fill += static_cast<std::size_t>(nbytes);
+
+		const std::string_view received{buffer, fill};
+		const auto colon = received.find(':');
+		if (colon == received.npos)
+			continue;
+
+		std::size_t size;
+		if (!ParseIntegerTo(received.substr(0, colon), size))
+			throw std::runtime_error{"Malformed response"};
+
+		const auto rest = received.substr(colon + 1);
+		if (rest.size() <= size)
+			continue;
+
+		if (rest[size] != ',')
+			throw std::runtime_error{"Malformed response"};
+
+		return std::string{rest.substr(0, size)};
+	}
+}
+
+std::string
+SubmitQmqpMemfd(SocketDescriptor s, FileDescriptor memfd)
+{
+	SendMemfd(s, memfd);
+	return ReceiveResponse(s);
+}
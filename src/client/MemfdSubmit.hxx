@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+
+class FileDescriptor;
+class UniqueFileDescriptor;
+class SocketDescriptor;
+
+/*
+ * Client side of the memfd submission protocol (see
+ * QmqpMemfd.hxx).
+ */
+
+/**
+ * Create a sealed memfd containing the QMQP payload.  Throws on
+ * error.
+ *
+ * @param message the message (headers and body)
+ */
+UniqueFileDescriptor
+CreateQmqpMemfd(std::string_view message, std::string_view sender,
+		std::span<const std::string_view> recipients);
+
+/**
+ * Like above, but read the message from a file descriptor (e.g. a
+ * pipe) until end of file, straight into the memfd.  Throws on
+ * error.
+ */
+UniqueFileDescriptor
+CreateQmqpMemfd(FileDescriptor message, std::string_view sender,
+		std::span<const std::string_view> recipients);
+
+/**
+ * Submit a memfd created by CreateQmqpMemfd() over a connected local
+ * socket and wait for the response.  Throws on error.
+ *
+ * @return the QMQP response (e.g. "Kok"), i.e. the payload of the
+ * response netstring
+ */
+std::string
+SubmitQmqpMemfd(SocketDescriptor s, FileDescriptor memfd);
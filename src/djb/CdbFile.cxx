@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "CdbFile.hxx"
+#include "lib/fmt/RuntimeError.hxx"
+#include "lib/fmt/SystemError.hxx"
+#include "io/Open.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+
+#include <cstdint>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static constexpr uint_least32_t
+CdbHash(std::string_view key) noexcept
+{
+	uint_least32_t h = 5381;
+	for (const char ch : key)
+		h = ((h << 5) + h) ^ static_cast<unsigned char>(ch);
+	return h & 0xffffffff;
+}
+
+static uint_least32_t
+ReadUint32(std::span<const std::byte> cdb, std::size_t offset) noexcept
+{
+	/* all integers are little-endian */
+	const auto *p = cdb.data() + offset;
+	return static_cast<uint_least32_t>(p[0]) |
+		(static_cast<uint_least32_t>(p[1]) << 8) |
+		(static_cast<uint_least32_t>(p[2]) << 16) |
+		(static_cast<uint_least32_t>(p[3]) << 24);
+}
+
+bool
+CdbVerify(std::span<const std::byte> cdb) noexcept
+{
+	if (cdb.size() < CDB_HEADER_SIZE)
+		return false;
+
+	for (std::size_t i = 0; i < 256; ++i) {
+		const std::size_t position = ReadUint32(cdb, i * 8);
+		const std::size_t n_slots = ReadUint32(cdb, i * 8 + 4);
+
+		if (n_slots == 0)
+			continue;
+
+		if (position < CDB_HEADER_SIZE || position > cdb.size() ||
+		    n_slots > (cdb.size() - position) / 8)
+			return false;
+	}
+
+	return true;
+}
+
+std::optional<std::string_view>
+CdbFind(std::span<const std::byte> cdb, std::string_view key) noexcept
+{
+	if (cdb.size() < CDB_HEADER_SIZE)
+		return std::nullopt;
+
+	const auto hash = CdbHash(key);
+
+	const std::size_t table = (hash & 0xff) * 8;
+	const std::size_t table_position = ReadUint32(cdb, table);
+	const std::size_t n_slots = ReadUint32(cdb, table + 4);
+	if (n_slots == 0)
+		return std::nullopt;
+
+	std::size_t slot = (hash >> 8) % n_slots;
+
+	for (std::size_t i = 0; i < n_slots; ++i) {
+		const std::size_t slot_position = table_position + slot * 8;
+		const auto slot_hash = ReadUint32(cdb, slot_position);
+		const std::size_t record_position = ReadUint32(cdb, slot_position + 4);
+
+		if (record_position == 0)
+			/* empty slot: not found */
+			break;
+
+		if (slot_hash == hash &&
+		    record_position <= cdb.size() - 8) {
+			const std::size_t key_size = ReadUint32(cdb, record_position);
+			const std::size_t value_size = ReadUint32(cdb, record_position + 4);
+			const std::size_t key_position = record_position + 8;
+			const auto rest = cdb.size() - key_position;
+
+			if (key_size == key.size() && key_size <= rest &&
+			    value_size <= rest - key_size &&
+			    std::memcmp(cdb.data() + key_position, key.data(),
+					key_size) == 0)
+				return std::string_view{
+					reinterpret_cast<const char *>(cdb.data() + key_position + key_size),
+					value_size,
+				};
+		}
+
+		if (++slot == n_slots)
+			slot = 0;
+	}
+
+	return std::nullopt;
+}
+
+std::size_t
+CdbGetRecordsEnd(std::span<const std::byte> cdb) noexcept
+{
+	if (cdb.size() < CDB_HEADER_SIZE)
+		return 0;
+
+	std::size_t end = cdb.size();
+	for (std::size_t i = 0; i < 256; ++i) {
+		const std::size_t position = ReadUint32(cdb, i * 8);
+		if (position >= CDB_HEADER_SIZE && position < end)
+			end = position;
+	}
+
+	return end;
+}
+
+std::size_t
+CdbReadRecord(std::span<const std::byte> cdb,
+	      std::size_t position, std::size_t end,
+	      std::string_view &key, std::string_view &value) noexcept
+{
+	if (position > end || end - position < 8)
+		return 0;
+
+	const std::size_t key_size = ReadUint32(cdb, position);
+	const std::size_t value_size = ReadUint32(cdb, position + 4);
+	position += 8;
+
+	if (key_size > end - position || value_size > end - position - key_size)
+		return 0;
+
+	const auto *p = reinterpret_cast<const char *>(cdb.data() + position);
+	key = {p, key_size};
+	value = {p + key_size, value_size};
+
+	return position + key_size + value_size;
+}
+
+CdbFile::CdbFile(const char *path)
+{
+	const auto fd = OpenReadOnly(path);
+
+	struct stat st;
+	if (fstat(fd.Get(), &st) < 0)
+		throw FmtErrno("Failed to stat {}", path);
+
+	if (!S_ISREG(st.st_mode))
+		throw FmtRuntimeError("Not a regular file: {}", path);
+
+	const std::size_t size = st.st_size;
+	if (size < CDB_HEADER_SIZE)
+		throw FmtRuntimeError("Malformed CDB file: {}", path);
+
+	void *p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.Get(), 0);
+	if (p == MAP_FAILED)
+		throw FmtErrno("Failed to map {}", path);
+
+	data = {static_cast<const std::byte *>(p), size};
+
+	if (!CdbVerify(data)) {
+		munmap(p, size);
+		throw FmtRuntimeError("Malformed CDB file: {}", path);
+	}
+
+	/* lookups jump around randomly; readahead is useless */
+	madvise(p, size, MADV_RANDOM);
+}
+
+CdbFile::~CdbFile() noexcept
+{
+	if (data.data() != nullptr)
+		munmap(const_cast<std::byte *>(data.data()), data.size());
+}
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+/**
+ * The header consists of 256 (position, length) pairs, one for
+ * each hash table; the records follow.
+ */
+static constexpr std::size_t CDB_HEADER_SIZE = 256 * 8;
+
+/**
+ * Check whether the buffer is a well-formed constant database
+ * (https://cr.yp.to/cdb.html): the header and all hash tables must
+ * be inside the buffer.  Records are checked only by CdbFind().
+ */
+[[gnu::pure]]
+bool
+CdbVerify(std::span<const std::byte> cdb) noexcept;
+
+/**
+ * Look up a key in a constant database which has been checked
+ * with CdbVerify().  Corrupt records are treated as "not found".
+ *
+ * @return the value of the first record with this key (pointing
+ * into @p cdb) or std::nullopt if there is none
+ */
+[[gnu::pure]]
+std::optional<std::string_view>
+CdbFind(std::span<const std::byte> cdb, std::string_view key) noexcept;
+
+/**
+ * Determine the end of the records (i.e. the position of the first
+ * hash table) of a database which has been checked with
+ * CdbVerify().
+ */
+[[gnu::pure]]
+std::size_t
+CdbGetRecordsEnd(std::span<const std::byte> cdb) noexcept;
+
+/**
+ * Parse the record at the specified position.
+ *
+ * @param end the return value of CdbGetRecordsEnd()
+ * @return the position of the next record or 0 if the record is
+ * malformed
+ */
+std::size_t
+CdbReadRecord(std::span<const std::byte> cdb,
+	      std::size_t position, std::size_t end,
+	      std::string_view &key, std::string_view &value) noexcept;
+
+/**
+ * Invoke a function for each record (in file order).  Iteration
+ * stops at the first malformed record.
+ */
+void
+CdbForEach(std::span<const std::byte> cdb, auto &&f)
+{
+	const std::size_t end = CdbGetRecordsEnd(cdb);
+
+	std::string_view key, value;
+	for (std::size_t position = CDB_HEADER_SIZE; position < end;) {
+		position = CdbReadRecord(cdb, position, end, key, value);
+		if (position == 0)
+			break;
+
+		f(key, value);
+	}
+}
+
+/**
+ * A constant database file mapped into memory.  Lookups do not
+ * allocate memory and do not make system calls (other than page
+ * faults).
+ */
+class CdbFile {
+	std::span<const std::byte> data;
+
+public:
+	CdbFile() noexcept = default;
+
+	/**
+	 * Open and map the file.  Throws on error.
+	 */
+	explicit CdbFile(const char *path);
+
+	~CdbFile() noexcept;
+
+	CdbFile(CdbFile &&src) noexcept
+		:data(std::exchange(src.data, {})) {}
+
+	CdbFile &operator=(CdbFile &&src) noexcept {
+		using std::swap;
+		swap(data, src.data);
+		return *this;
+	}
+
+	bool IsDefined() const noexcept {
+		return data.data() != nullptr;
+	}
+
+	std::size_t GetSize() const noexcept {
+		return data.size();
+	}
+
+	[[gnu::pure]]
+	std::optional<std::string_view> Find(std::string_view key) const noexcept {
+		return CdbFind(data, key);
+	}
+
+	void ForEach(auto &&f) const {
+		CdbForEach(data, f);
+	}
+};
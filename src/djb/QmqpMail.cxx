@@ -51,3 +51,19 @@ QmqpMail::Parse(std::span<const std::byte> __input) noexcept
 
 	return ParseResult::SUCCESS;
 }
+
+std::string
+GenerateQmqpTail(std::span<const std::string_view> recipients) noexcept
+{
+	/* the trailing comma of the sender netstring */
+	std::string tail{","};
+
+	for (const auto i : recipients) {
+		tail.append(std::to_string(i.size()));
+		tail.push_back(':');
+		tail.append(i);
+		tail.push_back(',');
+	}
+
+	return tail;
+}
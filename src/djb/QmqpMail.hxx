@@ -5,6 +5,7 @@
 #pragma once
 
 #include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -64,3 +65,10 @@ struct QmqpMail {
 
 	ParseResult Parse(std::span<const std::byte> input) noexcept;
 };
+
+/**
+ * Generate a #QmqpMail::tail with a different list of recipients,
+ * e.g. a subset of QmqpMail::recipients.
+ */
+std::string
+GenerateQmqpTail(std::span<const std::string_view> recipients) noexcept;
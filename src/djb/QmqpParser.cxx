@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "QmqpParser.hxx"
+#include "uri/EmailAddress.hxx"
+
+#include <algorithm>
+
+inline std::optional<QmqpParser::Result>
+QmqpParser::ParseLength(char ch) noexcept
+{
+	/* the same rules as ParseNetstring() */
+
+	if (ch == ':') {
+		if (!have_digits)
+			return Result::MALFORMED;
+
+		/* the value and the comma must fit into the rest of
+		   the payload */
+		if (value_size >= size - position - 1)
+			return Result::MALFORMED;
+
+		value_start = position + 1;
+		state = State::VALUE;
+		return std::nullopt;
+	}
+
+	if (ch < '0' || ch > '9')
+		return Result::MALFORMED;
+
+	if (!have_digits) {
+		leading_zero = ch == '0';
+		have_digits = true;
+	}
+
+	/* this cannot overflow because the value is never larger
+	   than the payload size (see below) */
+	value_size = value_size * 10 + static_cast<std::size_t>(ch - '0');
+
+	if (value_size > 0 && leading_zero)
+		/* reject leading zeroes */
+		return Result::MALFORMED;
+
+	/* more digits can only make the value larger; reject it
+	   early if the colon, the value and the comma cannot fit
+	   into the rest of the payload anymore */
+	if (value_size > 0 && value_size + 2 > size - position - 1)
+		return Result::MALFORMED;
+
+	return std::nullopt;
+}
+
+inline std::optional<QmqpParser::Result>
+QmqpParser::OnField(std::string_view value) noexcept
+{
+	switch (n_fields++) {
+	case 0:
+		mail.message = value;
+		break;
+
+	case 1:
+		if (!VerifyEmailAddress(value))
+			return Result::BAD_ADDRESS;
+
+		mail.sender = value;
+		tail_start = position;
+		break;
+
+	default:
+		if (!VerifyEmailAddress(value))
+			return Result::BAD_ADDRESS;
+
+		if (mail.recipients.size() >= QmqpMail::MAX_RECIPIENTS)
+			return Result::TOO_MANY_RECIPIENTS;
+
+		mail.recipients.push_back(value);
+		break;
+	}
+
+	return std::nullopt;
+}
+
+std::optional<QmqpParser::Result>
+QmqpParser::Feed(std::string_view received) noexcept
+{
+	received = received.substr(0, size);
+
+	while (position < received.size()) {
+		switch (state) {
+		case State::LENGTH:
+			if (auto result = ParseLength(received[position]))
+				return result;
+
+			++position;
+			break;
+
+		case State::VALUE:
+			/* skip the value without looking at it; it
+			   will be verified when it is complete */
+			position = std::min(value_start + value_size,
+					    received.size());
+			if (position == value_start + value_size)
+				state = State::COMMA;
+			break;
+
+		case State::COMMA:
+			if (received[position] != ',')
+				return Result::MALFORMED;
+
+			if (auto result = OnField(received.substr(value_start, value_size)))
+				return result;
+
+			++position;
+			state = State::LENGTH;
+			value_size = 0;
+			have_digits = false;
+			break;
+		}
+	}
+
+	if (position < size)
+		return std::nullopt;
+
+	/* the whole payload has been parsed; it must end with a
+	   complete netstring, and there must be at least one
+	   recipient */
+	if (state != State::LENGTH || have_digits || n_fields < 3)
+		return Result::MALFORMED;
+
+	mail.tail = received.substr(tail_start);
+	return Result::SUCCESS;
+}
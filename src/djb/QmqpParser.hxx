@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include "QmqpMail.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+/**
+ * An incremental QMQP parser.  It is fed with the payload of the
+ * outer netstring while it is still being received, and it keeps
+ * track of the inner netstrings (message, sender, recipients).
+ * Malformed input and bad addresses are detected as early as
+ * possible, and the #QmqpMail is ready as soon as the last byte has
+ * been received.
+ *
+ * The results are the same as QmqpMail::Parse() on the complete
+ * payload.
+ */
+class QmqpParser {
+	QmqpMail mail;
+
+	/**
+	 * The size of the complete payload.
+	 */
+	const std::size_t size;
+
+	/**
+	 * The number of bytes already parsed.
+	 */
+	std::size_t position = 0;
+
+	/**
+	 * The start of the current inner netstring's value.
+	 */
+	std::size_t value_start;
+
+	/**
+	 * The size of the current inner netstring (while parsing the
+	 * header, this is the value of the digits parsed so far).
+	 */
+	std::size_t value_size = 0;
+
+	/**
+	 * The position of the comma after the sender (i.e. the start
+	 * of QmqpMail::tail).
+	 */
+	std::size_t tail_start;
+
+	/**
+	 * The number of inner netstrings parsed completely.
+	 */
+	std::size_t n_fields = 0;
+
+	enum class State : uint_least8_t {
+		/**
+		 * Parsing the length (digits and colon) of an inner
+		 * netstring.
+		 */
+		LENGTH,
+
+		/**
+		 * Skipping the value of an inner netstring.
+		 */
+		VALUE,
+
+		/**
+		 * Expecting the comma terminating an inner netstring.
+		 */
+		COMMA,
+	} state = State::LENGTH;
+
+	/**
+	 * Has at least one digit of the current length been
+	 * parsed?
+	 */
+	bool have_digits = false;
+
+	/**
+	 * Was the first digit of the current length a zero?
+	 */
+	bool leading_zero;
+
+public:
+	using Result = QmqpMail::ParseResult;
+
+	/**
+	 * @param _size the size of the complete payload
+	 */
+	explicit QmqpParser(std::size_t _size) noexcept
+		:size(_size) {}
+
+	QmqpParser(const QmqpParser &) = delete;
+	QmqpParser &operator=(const QmqpParser &) = delete;
+
+	/**
+	 * Parse newly received data.
+	 *
+	 * @param received all of the payload received so far; it
+	 * must be at the same address on each call and must never
+	 * shrink, because the #QmqpMail points into it
+	 * @return the result or std::nullopt if more data is needed
+	 * (#Result::SUCCESS only after the complete payload has been
+	 * received)
+	 */
+	std::optional<Result> Feed(std::string_view received) noexcept;
+
+	/**
+	 * Return the part of the message (the first inner netstring)
+	 * which has been parsed so far; it is empty until the
+	 * message's length has been parsed.
+	 *
+	 * @param received the same buffer which was passed to the
+	 * last Feed() call
+	 */
+	[[gnu::pure]]
+	std::string_view GetPartialMessage(std::string_view received) const noexcept {
+		if (n_fields > 0)
+			return mail.message;
+
+		if (state == State::LENGTH)
+			return {};
+
+		return received.substr(value_start, position - value_start);
+	}
+
+	/**
+	 * Obtain the parsed mail after Feed() has returned
+	 * #Result::SUCCESS.
+	 */
+	QmqpMail &GetMail() noexcept {
+		return mail;
+	}
+
+private:
+	std::optional<Result> ParseLength(char ch) noexcept;
+
+	/**
+	 * An inner netstring has been parsed completely.
+	 */
+	std::optional<Result> OnField(std::string_view value) noexcept;
+};
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "CharRange.hxx"
+
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+bool
+CheckCharRangeScalar(std::string_view s,
+		     unsigned char min, unsigned char max,
+		     unsigned char except) noexcept
+{
+	for (const char i : s) {
+		const auto ch = static_cast<unsigned char>(i);
+		if (ch < min || ch > max || ch == except)
+			return false;
+	}
+
+	return true;
+}
+
+#ifdef __x86_64__
+
+/*
+ * The vectorized implementations subtract "min" from each byte
+ * (with wrap-around) and check whether the result is not larger
+ * than "max-min" using an unsigned "max" instruction, because there
+ * is no unsigned byte comparison.
+ */
+
+bool
+CheckCharRangeSSE2(std::string_view s,
+		   unsigned char min, unsigned char max,
+		   unsigned char except) noexcept
+{
+	const __m128i v_min = _mm_set1_epi8(static_cast<char>(min));
+	const __m128i v_span = _mm_set1_epi8(static_cast<char>(max - min));
+	const __m128i v_except = _mm_set1_epi8(static_cast<char>(except));
+
+	const char *p = s.data();
+	std::size_t n = s.size();
+
+	for (; n >= sizeof(__m128i); p += sizeof(__m128i), n -= sizeof(__m128i)) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+		const __m128i offset = _mm_sub_epi8(v, v_min);
+		const __m128i in_range = _mm_cmpeq_epi8(_mm_max_epu8(offset, v_span),
+							v_span);
+		const __m128i is_except = _mm_cmpeq_epi8(v, v_except);
+
+		/* all bytes must be in range and none must be the
+		   exception */
+		if (_mm_movemask_epi8(_mm_andnot_si128(is_except, in_range)) != 0xffff)
+			return false;
+	}
+
+	return CheckCharRangeScalar({p, n}, min, max, except);
+}
+
+[[gnu::target("avx2")]]
+bool
+CheckCharRangeAVX2(std::string_view s,
+		   unsigned char min, unsigned char max,
+		   unsigned char except) noexcept
+{
+	const __m256i v_min = _mm256_set1_epi8(static_cast<char>(min));
+	const __m256i v_span = _mm256_set1_epi8(static_cast<char>(max - min));
+	const __m256i v_except = _mm256_set1_epi8(static_cast<char>(except));
+
+	const char *p = s.data();
+	std::size_t n = s.size();
+
+	for (; n >= sizeof(__m256i); p += sizeof(__m256i), n -= sizeof(__m256i)) {
+		const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+		const __m256i offset = _mm256_sub_epi8(v, v_min);
+		const __m256i in_range = _mm256_cmpeq_epi8(_mm256_max_epu8(offset, v_span),
+							   v_span);
+		const __m256i is_except = _mm256_cmpeq_epi8(v, v_except);
+
+		if (_mm256_movemask_epi8(_mm256_andnot_si256(is_except, in_range)) != -1)
+			return false;
+	}
+
+	/* the remainder is handled by the SSE2 implementation */
+	return CheckCharRangeSSE2({p, n}, min, max, except);
+}
+
+using CheckCharRangeFunction = bool (*)(std::string_view s,
+					unsigned char min, unsigned char max,
+					unsigned char except) noexcept;
+
+static CheckCharRangeFunction
+ChooseCheckCharRange() noexcept
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return CheckCharRangeAVX2;
+
+	/* SSE2 is part of the x86-64 baseline */
+	return CheckCharRangeSSE2;
+}
+
+static const CheckCharRangeFunction check_char_range = ChooseCheckCharRange();
+
+bool
+CheckCharRange(std::string_view s,
+	       unsigned char min, unsigned char max,
+	       unsigned char except) noexcept
+{
+	/* short strings are not worth the indirect call */
+	if (s.size() < sizeof(__m128i))
+		return CheckCharRangeScalar(s, min, max, except);
+
+	return check_char_range(s, min, max, except);
+}
+
+#else
+
+bool
+CheckCharRange(std::string_view s,
+	       unsigned char min, unsigned char max,
+	       unsigned char except) noexcept
+{
+	return CheckCharRangeScalar(s, min, max, except);
+}
+
+#endif
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <cassert>
+#include <string_view>
+
+/*
+ * Vectorized character class checks.  On x86-64, an AVX2 or SSE2
+ * implementation is chosen at startup depending on what the CPU
+ * supports; other architectures use the scalar implementation.
+ */
+
+/**
+ * Does the string consist only of bytes between @p min and @p max
+ * (inclusive, compared as unsigned bytes) except for @p except?
+ * Pass an @p except value outside of the range to disable the
+ * exception.
+ */
+[[gnu::pure]]
+bool
+CheckCharRange(std::string_view s,
+	       unsigned char min, unsigned char max,
+	       unsigned char except) noexcept;
+
+[[gnu::pure]]
+inline bool
+CheckCharRange(std::string_view s,
+	       unsigned char min, unsigned char max) noexcept
+{
+	assert(min > 0);
+
+	/* "min-1" is outside of the range */
+	return CheckCharRange(s, min, max,
+			      static_cast<unsigned char>(min - 1));
+}
+
+/*
+ * The individual implementations, exported only for the unit
+ * tests.
+ */
+
+[[gnu::pure]]
+bool
+CheckCharRangeScalar(std::string_view s,
+		     unsigned char min, unsigned char max,
+		     unsigned char except) noexcept;
+
+#ifdef __x86_64__
+
+[[gnu::pure]]
+bool
+CheckCharRangeSSE2(std::string_view s,
+		   unsigned char min, unsigned char max,
+		   unsigned char except) noexcept;
+
+/**
+ * Must only be called if the CPU supports AVX2.
+ */
+[[gnu::pure]]
+bool
+CheckCharRangeAVX2(std::string_view s,
+		   unsigned char min, unsigned char max,
+		   unsigned char except) noexcept;
+
+#endif
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "PatternSet.hxx"
+#include "util/CharUtil.hxx"
+
+#include <stdexcept>
+
+PatternSet::PatternSet(std::span<const std::string_view> _patterns,
+		       bool ignore_case)
+{
+	patterns.reserve(_patterns.size());
+
+	/* assign a class to each byte which appears in a pattern */
+
+	for (const std::string_view i : _patterns) {
+		if (i.empty())
+			throw std::invalid_argument{"Empty pattern"};
+
+		patterns.emplace_back(i);
+
+		for (const char ch : i) {
+			const char lower = ignore_case ? ToLowerASCII(ch) : ch;
+			if (classes[static_cast<unsigned char>(lower)] != 0)
+				continue;
+
+			const auto c = static_cast<uint_least16_t>(n_classes++);
+			classes[static_cast<unsigned char>(lower)] = c;
+			if (ignore_case && lower >= 'a' && lower <= 'z')
+				classes[static_cast<unsigned char>(lower - 'a' + 'A')] = c;
+		}
+	}
+
+	/* build the trie; a child value of 0 means "no child"
+	   (the root cannot be a child) */
+
+	std::vector<uint_least32_t> trie(n_classes, 0);
+	outputs.push_back(npos);
+
+	for (std::size_t i = 0; i < patterns.size(); ++i) {
+		uint_least32_t state = 0;
+
+		for (const char ch : patterns[i]) {
+			const std::size_t t = state * n_classes +
+				classes[static_cast<unsigned char>(ch)];
+			if (trie[t] == 0) {
+				const std::size_t n_states = outputs.size();
+				if ((n_states + 1) * n_classes >= MATCH_FLAG)
+					throw std::invalid_argument{"Too many patterns"};
+
+				trie[t] = static_cast<uint_least32_t>(n_states);
+				trie.resize(trie.size() + n_classes, 0);
+				outputs.push_back(npos);
+			}
+
+			state = trie[t];
+		}
+
+		if (outputs[state] == npos)
+			outputs[state] = i;
+	}
+
+	/* convert the trie to a DFA by following the failure links
+	   in breadth-first order; for now, transitions contain state
+	   numbers */
+
+	const std::size_t n_states = outputs.size();
+	transitions.resize(trie.size());
+
+	std::vector<uint_least32_t> fail(n_states, 0);
+	std::vector<uint_least32_t> queue;
+	queue.reserve(n_states);
+
+	for (std::size_t c = 0; c < n_classes; ++c) {
+		if (const auto child = trie[c]; child != 0)
+			queue.push_back(child);
+
+		transitions[c] = trie[c];
+	}
+
+	for (std::size_t q = 0; q < queue.size(); ++q) {
+		const std::size_t state = queue[q];
+		const std::size_t f = fail[state];
+
+		/* the failure state is less deep, and its output
+		   has therefore been completed already */
+		if (outputs[state] == npos)
+			outputs[state] = outputs[f];
+
+		for (std::size_t c = 0; c < n_classes; ++c) {
+			const std::size_t t = state * n_classes + c;
+			const auto fallback = transitions[f * n_classes + c];
+
+			if (const auto child = trie[t]; child != 0) {
+				fail[child] = fallback;
+				queue.push_back(child);
+				transitions[t] = child;
+			} else
+				transitions[t] = fallback;
+		}
+	}
+
+	/* now convert state numbers to row offsets */
+
+	for (auto &t : transitions) {
+		const bool match = outputs[t] != npos;
+		t = static_cast<uint_least32_t>(t * n_classes);
+		if (match)
+			t |= MATCH_FLAG;
+	}
+}
+
+std::size_t
+PatternSet::Find(std::string_view haystack) const noexcept
+{
+	const auto *const table = transitions.data();
+	uint_least32_t row = 0;
+
+	for (const char ch : haystack) {
+		const auto next = table[row + classes[static_cast<unsigned char>(ch)]];
+		if (next & MATCH_FLAG) [[unlikely]]
+			return outputs[(next & ~MATCH_FLAG) / n_classes];
+
+		row = next;
+	}
+
+	return npos;
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * A set of literal patterns which can be searched for in one pass
+ * (Aho-Corasick).  The automaton is compiled into a dense
+ * transition table over byte classes (all bytes which do not appear
+ * in any pattern share one class), so scanning costs one table load
+ * per input byte, independent of the number of patterns.
+ */
+class PatternSet {
+	/**
+	 * This bit is set in a transition if the target state
+	 * completes at least one pattern.
+	 */
+	static constexpr uint_least32_t MATCH_FLAG = 0x80000000;
+
+	std::vector<std::string> patterns;
+
+	/**
+	 * Maps each byte to its class.  Class 0 is the one for bytes
+	 * which do not appear in any pattern.
+	 */
+	std::array<uint_least16_t, 256> classes{};
+
+	std::size_t n_classes = 1;
+
+	/**
+	 * The transition table; each entry is the row offset of the
+	 * target state (i.e. the state number multiplied with
+	 * #n_classes), possibly with #MATCH_FLAG.
+	 */
+	std::vector<uint_least32_t> transitions;
+
+	/**
+	 * The pattern (index into #patterns) completed by each state
+	 * (by state number), or SIZE_MAX.
+	 */
+	std::vector<std::size_t> outputs;
+
+public:
+	static constexpr std::size_t npos = SIZE_MAX;
+
+	/**
+	 * Throws std::invalid_argument if a pattern is empty or if
+	 * the automaton would be too large.
+	 *
+	 * @param ignore_case compare ASCII letters case-insensitively
+	 */
+	PatternSet(std::span<const std::string_view> _patterns,
+		   bool ignore_case);
+
+	PatternSet(PatternSet &&) noexcept = default;
+	PatternSet &operator=(PatternSet &&) noexcept = default;
+
+	std::size_t size() const noexcept {
+		return patterns.size();
+	}
+
+	std::string_view GetPattern(std::size_t i) const noexcept {
+		return patterns[i];
+	}
+
+	/**
+	 * Search for the first occurrence of any of the patterns.
+	 *
+	 * @return the index of the pattern whose occurrence ends
+	 * first in @p haystack or #npos if none was found
+	 */
+	[[gnu::pure]]
+	std::size_t Find(std::string_view haystack) const noexcept;
+};
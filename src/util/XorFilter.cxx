@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "XorFilter.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * The "finalizer" of MurmurHash3; it spreads all input bits over
+ * all output bits.
+ */
+static constexpr uint_least64_t
+Mix(uint_least64_t h) noexcept
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+static constexpr uint_least64_t
+RotateLeft(uint_least64_t x, unsigned n) noexcept
+{
+	return (x << n) | (x >> (64 - n));
+}
+
+/**
+ * Map a 32 bit value to the range [0, n) without a division.
+ */
+static constexpr std::size_t
+Reduce(uint_least32_t x, std::size_t n) noexcept
+{
+	return static_cast<std::size_t>((static_cast<uint_least64_t>(x) * n) >> 32);
+}
+
+uint_least64_t
+XorFilter::Hash(std::string_view key) noexcept
+{
+	/* FNV-1a */
+	uint_least64_t h = 0xcbf29ce484222325ULL;
+	for (const char ch : key) {
+		h ^= static_cast<unsigned char>(ch);
+		h *= 0x100000001b3ULL;
+	}
+
+	return Mix(h);
+}
+
+inline XorFilter::Positions
+XorFilter::GetPositions(uint_least64_t hash) const noexcept
+{
+	const uint_least64_t h = Mix(hash + seed);
+
+	return {
+		.p = {
+			Reduce(static_cast<uint_least32_t>(h), block_length),
+			Reduce(static_cast<uint_least32_t>(RotateLeft(h, 21)), block_length) + block_length,
+			Reduce(static_cast<uint_least32_t>(RotateLeft(h, 42)), block_length) + 2 * block_length,
+		},
+		.fingerprint = static_cast<uint_least8_t>(h ^ (h >> 32)),
+	};
+}
+
+inline bool
+XorFilter::Populate(std::span<const uint_least64_t> hashes,
+		    std::span<std::pair<uint_least64_t, std::size_t>> stack)
+{
+	const std::size_t capacity = block_length * 3;
+
+	/* for each slot: the xor of all hashes mapped to it and
+	   their number */
+	std::vector<uint_least64_t> xor_masks(capacity, 0);
+	std::vector<uint_least32_t> counts(capacity, 0);
+
+	for (const auto hash : hashes) {
+		const auto positions = GetPositions(hash);
+		for (const auto p : positions.p) {
+			xor_masks[p] ^= hash;
+			++counts[p];
+		}
+	}
+
+	/* peel: repeatedly remove a hash which is the only one in
+	   one of its slots */
+
+	std::vector<std::size_t> queue;
+	for (std::size_t i = 0; i < capacity; ++i)
+		if (counts[i] == 1)
+			queue.push_back(i);
+
+	std::size_t stack_size = 0;
+
+	while (!queue.empty()) {
+		const std::size_t i = queue.back();
+		queue.pop_back();
+
+		if (counts[i] != 1)
+			continue;
+
+		const auto hash = xor_masks[i];
+		stack[stack_size++] = {hash, i};
+
+		for (const auto p : GetPositions(hash).p) {
+			xor_masks[p] ^= hash;
+			if (--counts[p] == 1)
+				queue.push_back(p);
+		}
+	}
+
+	if (stack_size < hashes.size())
+		return false;
+
+	/* assign fingerprints in reverse peeling order: each slot
+	   is chosen such that the xor of the three slots of its
+	   hash equals the fingerprint */
+
+	std::fill_n(fingerprints.get(), capacity, 0);
+
+	for (auto i = stack.rbegin(); i != stack.rend(); ++i) {
+		const auto &[hash, slot] = *i;
+		const auto positions = GetPositions(hash);
+
+		fingerprints[slot] = positions.fingerprint ^
+			fingerprints[positions.p[0]] ^
+			fingerprints[positions.p[1]] ^
+			fingerprints[positions.p[2]];
+	}
+
+	return true;
+}
+
+XorFilter::XorFilter(std::span<uint_least64_t> hashes)
+{
+	if (hashes.empty())
+		return;
+
+	/* duplicates could never be peeled */
+	std::sort(hashes.begin(), hashes.end());
+	hashes = hashes.first(std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+
+	const std::size_t capacity = 32 + static_cast<std::size_t>(std::ceil(1.23 * static_cast<double>(hashes.size())));
+	block_length = capacity / 3;
+	fingerprints = std::make_unique<uint_least8_t[]>(block_length * 3);
+
+	std::vector<std::pair<uint_least64_t, std::size_t>> stack(hashes.size());
+
+	/* this succeeds with a high probability on the first
+	   attempt */
+	do {
+		seed = Mix(seed + 0x9e3779b97f4a7c15ULL);
+	} while (!Populate(hashes, stack));
+}
+
+bool
+XorFilter::MayContain(uint_least64_t hash) const noexcept
+{
+	if (block_length == 0)
+		return false;
+
+	const auto positions = GetPositions(hash);
+	return positions.fingerprint == (fingerprints[positions.p[0]] ^
+					 fingerprints[positions.p[1]] ^
+					 fingerprints[positions.p[2]]);
+}
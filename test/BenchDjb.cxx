@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "djb/NetstringParser.hxx"
+#include "djb/QmqpMail.hxx"
+#include "util/PatternSet.hxx"
+#include "uri/EmailAddress.hxx"
+#include "util/SpanCast.hxx"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using std::string_view_literals::operator""sv;
+
+namespace {
+
+std::string
+Netstring(std::string_view payload)
+{
+	std::string result = std::to_string(payload.size());
+	result.push_back(':');
+	result.append(payload);
+	result.push_back(',');
+	return result;
+}
+
+std::string
+MakeMessage(std::size_t size)
+{
+	std::string message = "Subject: benchmark\n\n";
+	message.resize(std::max(size, message.size()), 'x');
+	return message;
+}
+
+std::string
+MakeQmqp(std::size_t message_size, std::size_t n_recipients)
+{
+	std::string payload = Netstring(MakeMessage(message_size));
+	payload += Netstring("sender@example.com"sv);
+
+	for (std::size_t i = 0; i < n_recipients; ++i)
+		payload += Netstring("rcpt" + std::to_string(i) + "@example.com");
+
+	return payload;
+}
+
+void
+RunParse(benchmark::State &state, const std::string &input)
+{
+	for (auto _ : state) {
+		QmqpMail mail;
+		auto result = mail.Parse(AsBytes(input));
+		benchmark::DoNotOptimize(result);
+		benchmark::DoNotOptimize(mail);
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+				static_cast<int64_t>(input.size()));
+}
+
+} // anonymous namespace
+
+static void
+BM_ParseNetstring(benchmark::State &state)
+{
+	const auto input = Netstring(MakeMessage(state.range(0)));
+
+	for (auto _ : state) {
+		std::string_view i = input;
+		auto value = ParseNetstring(i);
+		benchmark::DoNotOptimize(value);
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+				static_cast<int64_t>(input.size()));
+}
+
+BENCHMARK(BM_ParseNetstring)->RangeMultiplier(8)->Range(1024, 64 << 20);
+
+static void
+BM_ParseRecipients(benchmark::State &state)
+{
+	RunParse(state, MakeQmqp(1024, state.range(0)));
+}
+
+BENCHMARK(BM_ParseRecipients)->RangeMultiplier(4)->Range(1, QmqpMail::MAX_RECIPIENTS);
+
+static void
+BM_ParseMessageSize(benchmark::State &state)
+{
+	RunParse(state, MakeQmqp(state.range(0), 1));
+}
+
+BENCHMARK(BM_ParseMessageSize)->RangeMultiplier(8)->Range(1024, 64 << 20);
+
+static void
+BM_ParseTooManyRecipients(benchmark::State &state)
+{
+	RunParse(state, MakeQmqp(1024, QmqpMail::MAX_RECIPIENTS + 1));
+}
+
+BENCHMARK(BM_ParseTooManyRecipients);
+
+static void
+BM_ParseBadLength(benchmark::State &state)
+{
+	/* the announced length exceeds the input */
+	RunParse(state, std::string{"999999999:Subject: foo\n\nbar,"sv});
+}
+
+BENCHMARK(BM_ParseBadLength);
+
+static void
+BM_ParseMissingComma(benchmark::State &state)
+{
+	auto input = MakeQmqp(state.range(0), 1);
+	input.back() = ';';
+	RunParse(state, input);
+}
+
+BENCHMARK(BM_ParseMissingComma)->Arg(1024)->Arg(1 << 20);
+
+static void
+BM_ParseBadAddress(benchmark::State &state)
+{
+	/* the last recipient is malformed */
+	auto input = MakeQmqp(1024, state.range(0));
+	input += Netstring("foo bar"sv);
+	RunParse(state, input);
+}
+
+BENCHMARK(BM_ParseBadAddress)->Arg(1)->Arg(QmqpMail::MAX_RECIPIENTS - 1);
+
+static void
+BM_VerifyEmailAddress(benchmark::State &state, std::string_view address)
+{
+	for (auto _ : state) {
+		bool result = VerifyEmailAddress(address);
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK_CAPTURE(BM_VerifyEmailAddress, short, "a@b.de"sv);
+BENCHMARK_CAPTURE(BM_VerifyEmailAddress, typical,
+		  "firstname.lastname@subdomain.example.com"sv);
+BENCHMARK_CAPTURE(BM_VerifyEmailAddress, long,
+		  "averyveryveryveryveryveryveryveryveryverylonglocalpart@"
+		  "a.very.very.very.very.very.very.long.domain.name.example.com"sv);
+BENCHMARK_CAPTURE(BM_VerifyEmailAddress, invalid, "foo bar@example.com"sv);
+
+static void
+BM_PatternSet(benchmark::State &state)
+{
+	/* the patterns look like URLs, and the message contains
+	   many partial matches */
+	std::vector<std::string> strings;
+	for (int64_t i = 0; i < state.range(0); ++i)
+		strings.emplace_back("http://spam" + std::to_string(i) + ".example/");
+
+	const std::vector<std::string_view> patterns(strings.begin(), strings.end());
+	const PatternSet set{patterns, true};
+
+	std::string message = "Subject: benchmark\n\n";
+	while (message.size() < (1 << 20))
+		message += "see http://www.example.com/ and http://spam.example/ ";
+
+	for (auto _ : state) {
+		auto result = set.Find(message);
+		benchmark::DoNotOptimize(result);
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+				static_cast<int64_t>(message.size()));
+}
+
+BENCHMARK(BM_PatternSet)->RangeMultiplier(10)->Range(1, 100000);
+
+BENCHMARK_MAIN();
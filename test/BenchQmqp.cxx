@@ -0,0 +1,381 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+/*
+ * Helper program for test/bench.py: a multi-connection QMQP load
+ * generator and stub QMQP servers which accept everything.
+ */
+
+#include "lib/fmt/SystemError.hxx"
+#include "system/Error.hxx"
+#include "util/PrintException.hxx"
+#include "util/StringAPI.hxx"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using std::string_view_literals::operator""sv;
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr std::string_view OK_RESPONSE = "3:Kok,"sv;
+
+static void
+AppendNetstring(std::string &dest, std::string_view value) noexcept
+{
+	fmt::format_to(std::back_inserter(dest), "{}:"sv, value.size());
+	dest.append(value);
+	dest.push_back(',');
+}
+
+static std::string
+MakeMessage(std::size_t size)
+{
+	std::string message = "Subject: qrelay benchmark\n\n";
+
+	static constexpr std::string_view line =
+		"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ\n"sv;
+	while (message.size() < size)
+		message.append(line.substr(0, std::min(line.size(),
+						       size - message.size())));
+
+	return message;
+}
+
+static std::string
+MakeRequest(std::size_t message_size, unsigned n_recipients)
+{
+	std::string body;
+	AppendNetstring(body, MakeMessage(message_size));
+	AppendNetstring(body, "sender@example.com"sv);
+
+	for (unsigned i = 0; i < n_recipients; ++i)
+		AppendNetstring(body, fmt::format("rcpt{}@example.com"sv, i));
+
+	std::string request;
+	AppendNetstring(request, body);
+	return request;
+}
+
+static sockaddr_un
+MakeLocalAddress(const char *path)
+{
+	sockaddr_un sun{};
+	sun.sun_family = AF_LOCAL;
+
+	const std::size_t length = strlen(path);
+	if (length >= sizeof(sun.sun_path))
+		throw std::runtime_error("Socket path too long");
+
+	std::copy_n(path, length + 1, sun.sun_path);
+	return sun;
+}
+
+static void
+WriteFull(int fd, std::string_view data)
+{
+	while (!data.empty()) {
+		const auto nbytes = send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+		if (nbytes < 0) {
+			if (errno == ENOTSOCK) {
+				/* stdout of the "exec" stub is a pipe */
+				const auto n = write(fd, data.data(), data.size());
+				if (n < 0)
+					throw MakeErrno("Failed to write");
+				data.remove_prefix(n);
+				continue;
+			}
+
+			throw MakeErrno("Failed to send");
+		}
+
+		data.remove_prefix(nbytes);
+	}
+}
+
+/**
+ * Read one netstring (without interpreting it) from the file
+ * descriptor.
+ *
+ * @return false on end of file before the netstring started
+ */
+static bool
+SkipNetstring(int fd)
+{
+	std::size_t length = 0;
+	bool empty = true;
+
+	while (true) {
+		char ch;
+		const auto nbytes = read(fd, &ch, 1);
+		if (nbytes < 0)
+			throw MakeErrno("Failed to read");
+
+		if (nbytes == 0) {
+			if (empty)
+				return false;
+			throw std::runtime_error("Premature end of file");
+		}
+
+		empty = false;
+
+		if (ch == ':')
+			break;
+
+		if (ch < '0' || ch > '9')
+			throw std::runtime_error("Malformed netstring header");
+
+		length = length * 10 + static_cast<std::size_t>(ch - '0');
+	}
+
+	/* the payload and the trailing comma */
+	std::size_t remaining = length + 1;
+	char buffer[65536];
+	while (remaining > 0) {
+		const auto nbytes = read(fd, buffer,
+					 std::min(remaining, sizeof(buffer)));
+		if (nbytes < 0)
+			throw MakeErrno("Failed to read");
+		if (nbytes == 0)
+			throw std::runtime_error("Premature end of file");
+
+		remaining -= static_cast<std::size_t>(nbytes);
+	}
+
+	return true;
+}
+
+static Clock::duration
+Submit(const sockaddr_un &address, std::string_view request)
+{
+	const auto start = Clock::now();
+
+	const int fd = socket(AF_LOCAL, SOCK_STREAM|SOCK_CLOEXEC, 0);
+	if (fd < 0)
+		throw MakeErrno("Failed to create socket");
+
+	try {
+		if (connect(fd, reinterpret_cast<const sockaddr *>(&address),
+			    sizeof(address)) < 0)
+			throw MakeErrno("Failed to connect");
+
+		WriteFull(fd, request);
+
+		char response[1024];
+		std::size_t fill = 0;
+		while (fill < sizeof(response)) {
+			const auto nbytes = recv(fd, response + fill,
+						 sizeof(response) - fill, 0);
+			if (nbytes < 0)
+				throw MakeErrno("Failed to receive");
+			if (nbytes == 0)
+				break;
+			fill += static_cast<std::size_t>(nbytes);
+		}
+
+		if (std::string_view{response, fill}.find(":K"sv) == std::string_view::npos)
+			throw std::runtime_error("Mail was not accepted");
+	} catch (...) {
+		close(fd);
+		throw;
+	}
+
+	close(fd);
+	return Clock::now() - start;
+}
+
+static double
+ToSeconds(Clock::duration d) noexcept
+{
+	return std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+}
+
+[[gnu::pure]]
+static double
+Percentile(const std::vector<Clock::duration> &sorted, double p) noexcept
+{
+	if (sorted.empty())
+		return 0;
+
+	const std::size_t i = std::min(static_cast<std::size_t>(static_cast<double>(sorted.size()) * p),
+				       sorted.size() - 1);
+	return ToSeconds(sorted[i]);
+}
+
+/**
+ * Submit #count mails over #concurrency parallel connections and
+ * print the results as a JSON object.
+ */
+static int
+Load(const char *socket_path, unsigned concurrency, unsigned count,
+     std::size_t message_size, unsigned n_recipients)
+{
+	const auto address = MakeLocalAddress(socket_path);
+	const auto request = MakeRequest(message_size, n_recipients);
+
+	std::atomic_uint next{0}, n_errors{0};
+	std::vector<std::vector<Clock::duration>> latencies(concurrency);
+
+	const auto start = Clock::now();
+
+	std::vector<std::thread> threads;
+	threads.reserve(concurrency);
+	for (unsigned i = 0; i < concurrency; ++i) {
+		threads.emplace_back([&, i]{
+			while (next.fetch_add(1) < count) {
+				try {
+					latencies[i].push_back(Submit(address, request));
+				} catch (...) {
+					if (n_errors.fetch_add(1) == 0)
+						PrintException(std::current_exception());
+				}
+			}
+		});
+	}
+
+	for (auto &i : threads)
+		i.join();
+
+	const auto duration = Clock::now() - start;
+
+	std::vector<Clock::duration> all;
+	for (const auto &i : latencies)
+		all.insert(all.end(), i.begin(), i.end());
+	std::sort(all.begin(), all.end());
+
+	fmt::print("{{\"mails\": {}, \"errors\": {}, \"seconds\": {:.6f}, "
+		   "\"throughput\": {:.1f}, "
+		   "\"latency\": {{\"p50\": {:.6f}, \"p90\": {:.6f}, "
+		   "\"p99\": {:.6f}, \"max\": {:.6f}}}}}\n"sv,
+		   all.size(), n_errors.load(), ToSeconds(duration),
+		   static_cast<double>(all.size()) / ToSeconds(duration),
+		   Percentile(all, 0.5), Percentile(all, 0.9),
+		   Percentile(all, 0.99), all.empty() ? 0. : ToSeconds(all.back()));
+
+	return n_errors > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void
+ServeConnection(int fd) noexcept
+try {
+	if (SkipNetstring(fd))
+		WriteFull(fd, OK_RESPONSE);
+	close(fd);
+} catch (...) {
+	close(fd);
+	PrintException(std::current_exception());
+}
+
+/**
+ * A stub QMQP server (for the "connect" action) which accepts all
+ * mails.
+ */
+static int
+Serve(const char *socket_path)
+{
+	const auto address = MakeLocalAddress(socket_path);
+	unlink(socket_path);
+
+	const int fd = socket(AF_LOCAL, SOCK_STREAM|SOCK_CLOEXEC, 0);
+	if (fd < 0)
+		throw MakeErrno("Failed to create socket");
+
+	if (bind(fd, reinterpret_cast<const sockaddr *>(&address),
+		 sizeof(address)) < 0)
+		throw FmtErrno("Failed to bind to {}", socket_path);
+
+	if (listen(fd, 256) < 0)
+		throw MakeErrno("Failed to listen");
+
+	while (true) {
+		const int connection = accept4(fd, nullptr, nullptr, SOCK_CLOEXEC);
+		if (connection < 0) {
+			if (errno == EINTR)
+				continue;
+			throw MakeErrno("Failed to accept");
+		}
+
+		std::thread{ServeConnection, connection}.detach();
+	}
+}
+
+/**
+ * A stub for the "exec" action: read a QMQP request from stdin and
+ * accept it.
+ */
+static int
+Exec()
+{
+	if (!SkipNetstring(STDIN_FILENO))
+		return EXIT_FAILURE;
+
+	WriteFull(STDOUT_FILENO, OK_RESPONSE);
+	return EXIT_SUCCESS;
+}
+
+/**
+ * A stub for the "exec_raw" action: consume the message from stdin
+ * and exit successfully.
+ */
+static int
+ExecRaw()
+{
+	char buffer[65536];
+	while (true) {
+		const auto nbytes = read(STDIN_FILENO, buffer, sizeof(buffer));
+		if (nbytes < 0)
+			throw MakeErrno("Failed to read");
+		if (nbytes == 0)
+			return EXIT_SUCCESS;
+	}
+}
+
+static unsigned
+ParseUnsigned(const char *s)
+{
+	char *endptr;
+	const auto value = strtoul(s, &endptr, 10);
+	if (endptr == s || *endptr != 0 || value == 0)
+		throw std::invalid_argument{fmt::format("Not a positive number: {}"sv, s)};
+
+	return static_cast<unsigned>(value);
+}
+
+int
+main(int argc, char **argv) noexcept
+try {
+	if (argc == 7 && StringIsEqual(argv[1], "load"))
+		return Load(argv[2], ParseUnsigned(argv[3]), ParseUnsigned(argv[4]),
+			    ParseUnsigned(argv[5]), ParseUnsigned(argv[6]));
+	else if (argc == 3 && StringIsEqual(argv[1], "serve"))
+		return Serve(argv[2]);
+	else if (argc >= 2 && StringIsEqual(argv[1], "exec"))
+		return Exec();
+	else if (argc >= 2 && StringIsEqual(argv[1], "exec-raw"))
+		return ExecRaw();
+
+	fmt::print(stderr, "Usage: {} load SOCKET CONCURRENCY COUNT SIZE RECIPIENTS\n"
+		   "       {} serve SOCKET\n"
+		   "       {} exec\n"
+		   "       {} exec-raw [ARGS...]\n"sv,
+		   argv[0], argv[0], argv[0], argv[0]);
+	return EXIT_FAILURE;
+} catch (...) {
+	PrintException(std::current_exception());
+	return EXIT_FAILURE;
+}
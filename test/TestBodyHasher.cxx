@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "BodyHasher.hxx"
+#include "HeaderIndex.hxx"
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+using std::string_view_literals::operator""sv;
+
+static BodyHash
+Hash(std::string_view message, std::size_t chunk_size=SIZE_MAX) noexcept
+{
+	BodyHasher hasher;
+	for (std::size_t i = 0; i < message.size();) {
+		i += std::min(chunk_size, message.size() - i);
+		hasher.Feed(message.substr(0, i));
+	}
+
+	return hasher.Finish();
+}
+
+TEST(BodyHasher, HeaderIgnored)
+{
+	const auto a = Hash("Subject: a\nMessage-ID: <1@example.com>\n\nHello world\n"sv);
+	const auto b = Hash("Subject: b\r\nDate: today\r\n\r\nHello world\n"sv);
+	const auto c = Hash("Subject: a\n\nHello world!\n"sv);
+
+	EXPECT_EQ(a, b);
+	EXPECT_NE(a, c);
+
+	/* no header at all */
+	EXPECT_EQ(Hash("\nHello world\n"sv), a);
+	EXPECT_EQ(Hash("\r\nHello world\n"sv), a);
+
+	/* no body */
+	EXPECT_EQ(Hash("Subject: a\n"sv), Hash(""sv));
+	EXPECT_EQ(Hash("Subject: a\n\n"sv), Hash(""sv));
+}
+
+TEST(BodyHasher, Chunked)
+{
+	static constexpr auto message =
+		"Subject: chunked\r\nX-Foo: bar\r\n\r\nline 1\r\n\r\nline 2\r\n"sv;
+
+	const auto expected = Hash(message);
+	EXPECT_EQ(expected, Hash("\r\nline 1\r\n\r\nline 2\r\n"sv));
+
+	for (std::size_t chunk_size = 1; chunk_size < message.size(); ++chunk_size)
+		EXPECT_EQ(Hash(message, chunk_size), expected) << chunk_size;
+}
+
+TEST(BodyHasher, Format)
+{
+	BodyHash hash{};
+	hash[0] = std::byte{0x01};
+	hash[15] = std::byte{0xfe};
+
+	const auto hex = FormatBodyHash(hash);
+	EXPECT_EQ(std::string_view(hex.data(), hex.size()),
+		  "010000000000000000000000000000fe"sv);
+}
+
+static BodyHash
+HashMail(std::string_view message) noexcept
+{
+	static constexpr std::string_view recipients[] = {"bar@example.com"sv};
+	return HashEnvelope(Hash(message), HeaderIndex{message},
+			    "foo@example.com"sv, recipients);
+}
+
+TEST(BodyHasher, Envelope)
+{
+	/* mails which differ only in the subject are not duplicates
+	   (e.g. alerts with an empty body) */
+	EXPECT_NE(HashMail("Subject: disk full\n\n"sv),
+		  HashMail("Subject: disk ok\n\n"sv));
+	EXPECT_NE(HashMail("From: a@example.com\nSubject: x\n\nbody\n"sv),
+		  HashMail("From: b@example.com\nSubject: x\n\nbody\n"sv));
+
+	/* volatile header fields are ignored */
+	EXPECT_EQ(HashMail("Subject: x\nDate: Mon, 19 Oct 2026 10:00:00 +0200\n"
+			   "Message-ID: <1@example.com>\n\nbody\n"sv),
+		  HashMail("Received: from localhost\nSubject: x\n"
+			   "message-id: <2@example.com>\n\nbody\n"sv));
+
+	/* the envelope is included */
+	static constexpr std::string_view other[] = {"baz@example.com"sv};
+	EXPECT_NE(HashMail("Subject: x\n\n"sv),
+		  HashEnvelope(Hash("Subject: x\n\n"sv),
+			       HeaderIndex{"Subject: x\n\n"sv},
+			       "foo@example.com"sv, other));
+}
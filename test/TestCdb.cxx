@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "djb/CdbFile.hxx"
+#include "util/SpanCast.hxx"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using std::string_view_literals::operator""sv;
+
+namespace {
+
+uint_least32_t
+Hash(std::string_view key) noexcept
+{
+	uint_least32_t h = 5381;
+	for (const char ch : key)
+		h = (((h << 5) + h) ^ static_cast<unsigned char>(ch)) & 0xffffffff;
+	return h;
+}
+
+void
+AppendUint32(std::string &dest, uint_least32_t value) noexcept
+{
+	for (unsigned i = 0; i < 4; ++i)
+		dest.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+}
+
+void
+WriteUint32(std::string &dest, std::size_t offset, uint_least32_t value) noexcept
+{
+	for (unsigned i = 0; i < 4; ++i)
+		dest[offset + i] = static_cast<char>((value >> (i * 8)) & 0xff);
+}
+
+/**
+ * A minimal implementation of cdbmake.
+ */
+std::string
+MakeCdb(const std::vector<std::pair<std::string_view, std::string_view>> &records)
+{
+	std::string cdb(2048, '\0');
+
+	std::vector<std::pair<uint_least32_t, uint_least32_t>> tables[256];
+
+	for (const auto &[key, value] : records) {
+		const auto h = Hash(key);
+		tables[h & 0xff].emplace_back(h, static_cast<uint_least32_t>(cdb.size()));
+
+		AppendUint32(cdb, key.size());
+		AppendUint32(cdb, value.size());
+		cdb.append(key);
+		cdb.append(value);
+	}
+
+	for (std::size_t i = 0; i < 256; ++i) {
+		const auto &table = tables[i];
+		const std::size_t n_slots = table.size() * 2;
+
+		WriteUint32(cdb, i * 8, cdb.size());
+		WriteUint32(cdb, i * 8 + 4, n_slots);
+
+		std::vector<std::pair<uint_least32_t, uint_least32_t>> slots(n_slots);
+		for (const auto &[h, position] : table) {
+			std::size_t slot = (h >> 8) % n_slots;
+			while (slots[slot].second != 0)
+				slot = (slot + 1) % n_slots;
+			slots[slot] = {h, position};
+		}
+
+		for (const auto &[h, position] : slots) {
+			AppendUint32(cdb, h);
+			AppendUint32(cdb, position);
+		}
+	}
+
+	return cdb;
+}
+
+} // anonymous namespace
+
+TEST(Cdb, Find)
+{
+	std::vector<std::pair<std::string_view, std::string_view>> records{
+		{"foo"sv, "bar"sv},
+		{"empty"sv, ""sv},
+		{"foo"sv, "second"sv},
+		{""sv, "empty key"sv},
+	};
+
+	std::vector<std::string> keys;
+	for (unsigned i = 0; i < 1000; ++i)
+		keys.emplace_back("user" + std::to_string(i) + "@example.com");
+	for (const std::string_view i : keys)
+		records.emplace_back(i, i.substr(0, i.find('@')));
+
+	const auto cdb = MakeCdb(records);
+	const auto data = AsBytes(cdb);
+	ASSERT_TRUE(CdbVerify(data));
+
+	EXPECT_EQ(CdbFind(data, "foo"sv), "bar"sv);
+	EXPECT_EQ(CdbFind(data, "empty"sv), ""sv);
+	EXPECT_EQ(CdbFind(data, ""sv), "empty key"sv);
+	EXPECT_FALSE(CdbFind(data, "fo"sv));
+	EXPECT_FALSE(CdbFind(data, "foobar"sv));
+
+	for (unsigned i = 0; i < 1000; ++i)
+		EXPECT_EQ(CdbFind(data, keys[i]), "user" + std::to_string(i));
+
+	EXPECT_FALSE(CdbFind(data, "user1000@example.com"sv));
+
+	std::size_t n = 0;
+	CdbForEach(data, [&](std::string_view key, std::string_view value){
+		ASSERT_LT(n, records.size());
+		EXPECT_EQ(key, records[n].first);
+		EXPECT_EQ(value, records[n].second);
+		++n;
+	});
+
+	EXPECT_EQ(n, records.size());
+}
+
+TEST(Cdb, Malformed)
+{
+	const auto cdb = MakeCdb({{"foo"sv, "bar"sv}});
+
+	/* too small */
+	EXPECT_FALSE(CdbVerify(AsBytes(std::string_view{cdb}.substr(0, 2047))));
+
+	/* a hash table points beyond the end of the file */
+	EXPECT_FALSE(CdbVerify(AsBytes(std::string_view{cdb}.substr(0, cdb.size() - 1))));
+
+	/* a record which exceeds the end of the file */
+	auto truncated = cdb;
+	truncated[2048 + 4] = '\x7f';
+	ASSERT_TRUE(CdbVerify(AsBytes(truncated)));
+	EXPECT_FALSE(CdbFind(AsBytes(truncated), "foo"sv));
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "util/CharRange.hxx"
+#include "util/StringVerify.hxx"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+
+using std::string_view_literals::operator""sv;
+
+namespace {
+
+/* the predicates which were used by LMail.cxx before
+   CheckCharRange() was introduced */
+
+constexpr bool
+IsValidHeaderNameChar(char ch) noexcept
+{
+	return ch >= 33 && ch <= 126 && ch != ':';
+}
+
+constexpr bool
+IsValidHeaderValueChar(char ch) noexcept
+{
+	return ch >= ' ' && ch <= 126;
+}
+
+/**
+ * Generate a random string which consists mostly of valid
+ * characters, with an occasional invalid one, so both results are
+ * well covered.
+ */
+std::string
+RandomString(std::mt19937 &rng, std::size_t length)
+{
+	std::uniform_int_distribution<int> valid{0x21, 0x7e}, any{0, 0xff};
+	std::bernoulli_distribution bad{1.0 / (length + 1)};
+
+	std::string s;
+	s.reserve(length);
+	for (std::size_t i = 0; i < length; ++i)
+		s.push_back(static_cast<char>(bad(rng) ? any(rng) : valid(rng)));
+
+	return s;
+}
+
+void
+CheckAllImplementations(std::string_view s,
+			unsigned char min, unsigned char max,
+			unsigned char except, bool expected)
+{
+	EXPECT_EQ(CheckCharRangeScalar(s, min, max, except), expected);
+	EXPECT_EQ(CheckCharRange(s, min, max, except), expected);
+
+#ifdef __x86_64__
+	EXPECT_EQ(CheckCharRangeSSE2(s, min, max, except), expected);
+
+	if (__builtin_cpu_supports("avx2")) {
+		EXPECT_EQ(CheckCharRangeAVX2(s, min, max, except), expected);
+	}
+#endif
+}
+
+} // anonymous namespace
+
+TEST(CharRange, Basic)
+{
+	EXPECT_TRUE(CheckCharRange(""sv, 33, 126));
+	EXPECT_TRUE(CheckCharRange("X-Foo"sv, 33, 126, ':'));
+	EXPECT_FALSE(CheckCharRange("X-Foo:"sv, 33, 126, ':'));
+	EXPECT_FALSE(CheckCharRange("X Foo"sv, 33, 126, ':'));
+	EXPECT_TRUE(CheckCharRange("hello world"sv, ' ', 126));
+	EXPECT_FALSE(CheckCharRange("hello\tworld"sv, ' ', 126));
+	EXPECT_FALSE(CheckCharRange("hello\x7fworld"sv, ' ', 126));
+	EXPECT_FALSE(CheckCharRange("hello w\xc3\xb6rld"sv, ' ', 126));
+}
+
+TEST(CharRange, Boundaries)
+{
+	/* every byte value at every position of a 64 byte string
+	   (covering all AVX2, SSE2 and scalar code paths) */
+	for (std::size_t length = 1; length <= 64; ++length) {
+		for (std::size_t position = 0; position < length; ++position) {
+			std::string s(length, 'a');
+			for (unsigned ch = 0; ch < 256; ++ch) {
+				s[position] = static_cast<char>(ch);
+				CheckAllImplementations(s, 33, 126, ':',
+							IsValidHeaderNameChar(static_cast<char>(ch)));
+				CheckAllImplementations(s, ' ', 126, ' ' - 1,
+							IsValidHeaderValueChar(static_cast<char>(ch)));
+			}
+		}
+	}
+}
+
+TEST(CharRange, Differential)
+{
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<std::size_t> length{0, 300};
+
+	for (unsigned i = 0; i < 20000; ++i) {
+		const auto s = RandomString(rng, length(rng));
+
+		CheckAllImplementations(s, 33, 126, ':',
+					CheckChars(s, IsValidHeaderNameChar));
+		CheckAllImplementations(s, ' ', 126, ' ' - 1,
+					CheckChars(s, IsValidHeaderValueChar));
+	}
+}
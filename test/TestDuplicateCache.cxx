@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "DuplicateCache.hxx"
+
+#include <gtest/gtest.h>
+
+using std::string_view_literals::operator""sv;
+
+static DuplicateCache::Key
+MakeKey(unsigned i) noexcept
+{
+	/* spread the keys like a hash would */
+	DuplicateCache::Key key{};
+	uint_least64_t x = (i + 1) * 0x9e3779b97f4a7c15ULL;
+	for (auto &b : key) {
+		b = static_cast<std::byte>(x);
+		x = (x >> 8) | (x << 56);
+	}
+
+	return key;
+}
+
+TEST(DuplicateCache, Basic)
+{
+	DuplicateCache cache{"test"sv, 64, std::chrono::seconds{10}};
+	EXPECT_EQ(cache.GetCapacity(), 64U);
+
+	const Event::TimePoint now{std::chrono::hours{1}};
+
+	EXPECT_FALSE(cache.Contains(MakeKey(1), now));
+	cache.Insert(MakeKey(1), now);
+	EXPECT_TRUE(cache.Contains(MakeKey(1), now));
+	EXPECT_FALSE(cache.Contains(MakeKey(2), now));
+
+	/* expiry */
+	EXPECT_TRUE(cache.Contains(MakeKey(1), now + std::chrono::seconds{9}));
+	EXPECT_FALSE(cache.Contains(MakeKey(1), now + std::chrono::seconds{10}));
+
+	/* refresh */
+	cache.Insert(MakeKey(1), now + std::chrono::seconds{5});
+	EXPECT_TRUE(cache.Contains(MakeKey(1), now + std::chrono::seconds{14}));
+
+	EXPECT_EQ(cache.GetLookups(), 6U);
+	EXPECT_EQ(cache.GetHits(), 3U);
+	EXPECT_EQ(cache.GetEvictions(), 0U);
+}
+
+TEST(DuplicateCache, Full)
+{
+	DuplicateCache cache{"test"sv, 100, std::chrono::seconds{10}};
+	EXPECT_EQ(cache.GetCapacity(), 128U);
+	EXPECT_EQ(cache.GetMemorySize(), cache.GetCapacity() * (sizeof(DuplicateCache::Key) + sizeof(Event::TimePoint)));
+
+	Event::TimePoint now{std::chrono::hours{1}};
+
+	/* insert many more keys than fit; the most recent ones must
+	   be found, and memory usage does not grow */
+	for (unsigned i = 0; i < 10000; ++i) {
+		cache.Insert(MakeKey(i), now);
+		now += std::chrono::microseconds{1};
+	}
+
+	EXPECT_GT(cache.GetEvictions(), 0U);
+	EXPECT_TRUE(cache.Contains(MakeKey(9999), now));
+
+	unsigned n_found = 0;
+	for (unsigned i = 0; i < 10000; ++i)
+		if (cache.Contains(MakeKey(i), now))
+			++n_found;
+
+	EXPECT_LE(n_found, cache.GetCapacity());
+	EXPECT_GT(n_found, cache.GetCapacity() / 2);
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "HeaderIndex.hxx"
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+#include <vector>
+
+using std::string_view_literals::operator""sv;
+
+TEST(HeaderIndex, Basic)
+{
+	const auto message = "From: foo@example.com\r\n"
+		"Subject: Hello\r\n"
+		"Received: one\r\n"
+		"received:  two\r\n"
+		"\r\n"
+		"X-Not-A-Header: body\r\n"sv;
+
+	const HeaderIndex index{message};
+	ASSERT_EQ(index.GetFields().size(), 4U);
+
+	const auto *from = index.Find("from"sv);
+	ASSERT_NE(from, nullptr);
+	EXPECT_EQ(from->name, "From"sv);
+	EXPECT_EQ(from->value, "foo@example.com"sv);
+
+	/* zero-copy: the value points into the message */
+	EXPECT_EQ(from->value.data(), message.data() + 6);
+
+	EXPECT_EQ(index.Find("X-Not-A-Header"sv), nullptr);
+	EXPECT_EQ(index.Find("Subject:"sv), nullptr);
+
+	std::vector<std::string_view> received;
+	index.ForEach("RECEIVED"sv, [&received](const auto &field){
+		received.push_back(field.value);
+	});
+
+	ASSERT_EQ(received.size(), 2U);
+	EXPECT_EQ(received[0], "one"sv);
+	EXPECT_EQ(received[1], "two"sv);
+}
+
+TEST(HeaderIndex, Folded)
+{
+	const auto message = "Subject: Hello\r\n"
+		"\tworld\r\n"
+		"  again\n"
+		"To: bar@example.com\n"
+		"\n"sv;
+
+	const HeaderIndex index{message};
+	ASSERT_EQ(index.GetFields().size(), 2U);
+
+	const auto *subject = index.Find("subject"sv);
+	ASSERT_NE(subject, nullptr);
+	EXPECT_EQ(subject->value, "Hello\r\n\tworld\r\n  again"sv);
+	EXPECT_TRUE(IsFoldedHeaderValue(subject->value));
+	EXPECT_EQ(UnfoldHeaderValue(subject->value), "Hello\tworld  again");
+
+	const auto *to = index.Find("to"sv);
+	ASSERT_NE(to, nullptr);
+	EXPECT_EQ(to->value, "bar@example.com"sv);
+	EXPECT_FALSE(IsFoldedHeaderValue(to->value));
+}
+
+TEST(HeaderIndex, Malformed)
+{
+	/* no header block at all */
+	EXPECT_TRUE(HeaderIndex{"hello world\r\n"sv}.GetFields().empty());
+	EXPECT_TRUE(HeaderIndex{""sv}.GetFields().empty());
+
+	/* a continuation line without a field */
+	EXPECT_TRUE(HeaderIndex{" foo\r\nFrom: bar\r\n"sv}.GetFields().empty());
+
+	/* parsing stops at a line which is not a header */
+	const HeaderIndex index{"From: foo\r\nbad line\r\nTo: bar\r\n"sv};
+	ASSERT_EQ(index.GetFields().size(), 1U);
+
+	/* the last line may lack a line break */
+	const HeaderIndex index2{"From: foo\r\nTo: bar"sv};
+	ASSERT_EQ(index2.GetFields().size(), 2U);
+	EXPECT_EQ(index2.Find("to"sv)->value, "bar"sv);
+}
+
+TEST(HeaderIndex, SameName)
+{
+	EXPECT_TRUE(IsSameHeaderName("From"sv, "from"sv));
+	EXPECT_TRUE(IsSameHeaderName("DKIM-Signature"sv, "dkim-SIGNATURE"sv));
+	EXPECT_FALSE(IsSameHeaderName("From"sv, "Fro"sv));
+	EXPECT_FALSE(IsSameHeaderName("To"sv, "Cc"sv));
+}
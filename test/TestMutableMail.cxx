@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "MutableMail.hxx"
+#include "util/SpanCast.hxx"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+using std::string_view_literals::operator""sv;
+
+static MutableMail
+MakeMail(std::string_view payload)
+{
+	AllocatedArray<std::byte> buffer{payload.size()};
+	std::copy_n(AsBytes(payload).begin(), payload.size(), buffer.begin());
+
+	MutableMail mail{std::move(buffer)};
+	if (mail.Parse() != QmqpMail::ParseResult::SUCCESS)
+		throw std::runtime_error{"Parse failed"};
+
+	return mail;
+}
+
+TEST(MutableMail, ShareBuffer)
+{
+	auto mail = MakeMail("7:Subject,18:sender@example.com,15:one@example.com,"sv);
+	const std::size_t size = mail.GetPayloadSize();
+
+	/* a copy of the string_views, like FanoutRelay makes */
+	const QmqpMail copy = mail;
+
+	const auto shared = mail.ShareBuffer();
+	ASSERT_TRUE(shared);
+	EXPECT_EQ(mail.buffer.size(), 0U);
+	EXPECT_EQ(shared->GetSize(), size);
+	EXPECT_EQ(mail.GetPayloadSize(), size);
+
+	/* a second call returns the same buffer */
+	EXPECT_EQ(mail.ShareBuffer(), shared);
+	EXPECT_EQ(shared.use_count(), 2);
+
+	/* the shared buffer keeps the message alive after the
+	   MutableMail has been freed */
+	mail.Free();
+	EXPECT_EQ(shared.use_count(), 1);
+	EXPECT_EQ(mail.GetPayloadSize(), 0U);
+
+	EXPECT_EQ(copy.message, "Subject"sv);
+	EXPECT_EQ(copy.sender, "sender@example.com"sv);
+	ASSERT_EQ(copy.recipients.size(), 1U);
+	EXPECT_EQ(copy.recipients.front(), "one@example.com"sv);
+}
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "util/PatternSet.hxx"
+#include "util/CharUtil.hxx"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using std::string_view_literals::operator""sv;
+
+namespace {
+
+/**
+ * The naive reference implementation: find the pattern whose
+ * occurrence ends first.
+ */
+std::size_t
+NaiveFind(std::span<const std::string_view> patterns,
+	  std::string_view haystack) noexcept
+{
+	std::size_t best = PatternSet::npos, best_end = SIZE_MAX;
+
+	for (std::size_t i = 0; i < patterns.size(); ++i) {
+		const auto pos = haystack.find(patterns[i]);
+		if (pos == haystack.npos)
+			continue;
+
+		const auto end = pos + patterns[i].size();
+		if (end < best_end) {
+			best = i;
+			best_end = end;
+		}
+	}
+
+	return best;
+}
+
+std::string
+RandomString(std::mt19937 &rng, std::size_t max_length)
+{
+	/* a small alphabet produces many partial matches */
+	static constexpr std::string_view alphabet = "abcAB."sv;
+
+	std::uniform_int_distribution<std::size_t> length_dist(1, max_length);
+	std::uniform_int_distribution<std::size_t> char_dist(0, alphabet.size() - 1);
+
+	std::string s(length_dist(rng), ' ');
+	for (auto &ch : s)
+		ch = alphabet[char_dist(rng)];
+	return s;
+}
+
+} // anonymous namespace
+
+TEST(PatternSet, Basic)
+{
+	static constexpr std::string_view patterns[] = {
+		"he"sv, "she"sv, "his"sv, "hers"sv,
+	};
+
+	const PatternSet set{patterns, false};
+	EXPECT_EQ(set.size(), 4U);
+
+	EXPECT_EQ(set.Find(""sv), PatternSet::npos);
+	EXPECT_EQ(set.Find("xyz"sv), PatternSet::npos);
+	EXPECT_EQ(set.Find("ushers"sv), 1U);
+	EXPECT_EQ(set.Find("this"sv), 2U);
+	EXPECT_EQ(set.Find("hers"sv), 0U);
+	EXPECT_EQ(set.Find("HERS"sv), PatternSet::npos);
+	EXPECT_EQ(set.GetPattern(3), "hers"sv);
+}
+
+TEST(PatternSet, IgnoreCase)
+{
+	static constexpr std::string_view patterns[] = {
+		"http://spam.example/"sv, "eval(base64_decode("sv,
+	};
+
+	const PatternSet set{patterns, true};
+	EXPECT_EQ(set.Find("click HTTP://Spam.Example/foo"sv), 0U);
+	EXPECT_EQ(set.Find("<?php EVAL(Base64_Decode('...'));"sv), 1U);
+	EXPECT_EQ(set.Find("http://spam.example"sv), PatternSet::npos);
+}
+
+TEST(PatternSet, Binary)
+{
+	static constexpr std::string_view patterns[] = {
+		"\0\xff"sv, "\x80"sv,
+	};
+
+	const PatternSet set{patterns, false};
+	EXPECT_EQ(set.Find("abc\0\xff"sv), 0U);
+	EXPECT_EQ(set.Find("abc\0\x80"sv), 1U);
+	EXPECT_EQ(set.Find("abc\0"sv), PatternSet::npos);
+}
+
+TEST(PatternSet, Empty)
+{
+	const PatternSet set{{}, false};
+	EXPECT_EQ(set.size(), 0U);
+	EXPECT_EQ(set.Find("foo"sv), PatternSet::npos);
+
+	static constexpr std::string_view empty_pattern[] = {
+		"foo"sv, ""sv,
+	};
+
+	EXPECT_THROW(PatternSet(empty_pattern, false), std::invalid_argument);
+}
+
+/**
+ * Compare with the naive implementation using random patterns and
+ * input.
+ */
+TEST(PatternSet, Random)
+{
+	std::mt19937 rng{42};
+
+	for (unsigned n = 0; n < 500; ++n) {
+		std::vector<std::string> strings;
+		const std::size_t n_patterns = 1 + n % 20;
+		for (std::size_t i = 0; i < n_patterns; ++i)
+			strings.emplace_back(RandomString(rng, 6));
+
+		std::vector<std::string_view> patterns(strings.begin(), strings.end());
+		const PatternSet set{patterns, false};
+
+		for (unsigned i = 0; i < 20; ++i) {
+			const auto haystack = RandomString(rng, 200);
+			const auto expected = NaiveFind(patterns, haystack);
+			const auto actual = set.Find(haystack);
+
+			/* if two patterns end at the same position,
+			   either one is correct */
+			if (expected == PatternSet::npos || actual == PatternSet::npos) {
+				EXPECT_EQ(actual, expected) << haystack;
+			} else {
+				const auto end = haystack.find(patterns[actual]) + patterns[actual].size();
+				EXPECT_EQ(end, haystack.find(patterns[expected]) + patterns[expected].size()) << haystack;
+			}
+		}
+	}
+}
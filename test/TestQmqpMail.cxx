@@ -107,3 +107,29 @@ TEST(QmqpMail, RejectsBadAddress)
 		ASSERT_EQ(mail.Parse(AsBytes(payload)), QmqpMail::ParseResult::BAD_ADDRESS) << payload;
 	}
 }
+
+TEST(QmqpMail, GenerateTail)
+{
+	const auto payload = MakeQmqp("Subject: Hello!\r\n\r\nBody\r\n"sv,
+				      "sender@example.com"sv,
+				      {"one@example.com"sv, "two@example.com"sv});
+
+	QmqpMail mail;
+	ASSERT_EQ(mail.Parse(AsBytes(payload)), QmqpMail::ParseResult::SUCCESS);
+
+	EXPECT_EQ(GenerateQmqpTail(mail.recipients), mail.tail);
+
+	const std::string_view subset[] = {"two@example.com"sv};
+	EXPECT_EQ(GenerateQmqpTail(subset), "," + Netstring("two@example.com"sv));
+
+	/* the tail begins with the trailing comma of the sender
+	   netstring */
+	const auto rewritten = Netstring(mail.message) +
+		std::to_string(mail.sender.size()) + ":" + std::string{mail.sender} +
+		GenerateQmqpTail(subset);
+
+	QmqpMail mail2;
+	ASSERT_EQ(mail2.Parse(AsBytes(rewritten)), QmqpMail::ParseResult::SUCCESS);
+	ASSERT_EQ(mail2.recipients.size(), 1U);
+	EXPECT_EQ(mail2.recipients[0], "two@example.com"sv);
+}
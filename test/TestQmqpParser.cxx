@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "djb/QmqpParser.hxx"
+#include "djb/QmqpMail.hxx"
+#include "util/SpanCast.hxx"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using std::string_literals::operator""s;
+using std::string_view_literals::operator""sv;
+
+namespace {
+
+std::string
+Netstring(std::string_view payload)
+{
+	std::string result = std::to_string(payload.size());
+	result.push_back(':');
+	result.append(payload);
+	result.push_back(',');
+	return result;
+}
+
+std::string
+MakeQmqp(std::string_view message, std::string_view sender,
+	 std::size_t n_recipients)
+{
+	std::string payload = Netstring(message);
+	payload += Netstring(sender);
+
+	for (std::size_t i = 0; i < n_recipients; ++i)
+		payload += Netstring("rcpt" + std::to_string(i) + "@example.com");
+
+	return payload;
+}
+
+/**
+ * Feed the payload to a #QmqpParser in chunks of random size and
+ * compare the result with QmqpMail::Parse().
+ */
+void
+CheckDifferential(std::mt19937 &rng, std::string_view payload)
+{
+	QmqpMail expected;
+	const auto expected_result = expected.Parse(AsBytes(payload));
+
+	QmqpParser parser{payload.size()};
+	std::optional<QmqpParser::Result> result;
+
+	std::uniform_int_distribution<std::size_t> chunk{1, payload.size() / 4 + 1};
+
+	std::size_t received = 0;
+	do {
+		received = std::min(received + chunk(rng), payload.size());
+		result = parser.Feed(payload.substr(0, received));
+
+		/* success must not be reported early */
+		if (result && *result == QmqpParser::Result::SUCCESS) {
+			ASSERT_EQ(received, payload.size());
+		}
+	} while (!result && received < payload.size());
+
+	ASSERT_TRUE(result) << payload;
+	ASSERT_EQ(*result, expected_result) << payload;
+
+	if (*result != QmqpParser::Result::SUCCESS)
+		return;
+
+	const auto &mail = parser.GetMail();
+	EXPECT_EQ(mail.message.data(), expected.message.data());
+	EXPECT_EQ(mail.message.size(), expected.message.size());
+	EXPECT_EQ(mail.sender.data(), expected.sender.data());
+	EXPECT_EQ(mail.sender.size(), expected.sender.size());
+	EXPECT_EQ(mail.tail.data(), expected.tail.data());
+	EXPECT_EQ(mail.tail.size(), expected.tail.size());
+	EXPECT_EQ(mail.recipients, expected.recipients);
+}
+
+/**
+ * Apply a random modification to the payload.
+ */
+void
+Mutate(std::mt19937 &rng, std::string &payload)
+{
+	static constexpr std::string_view interesting = "0123456789:, @x\n"sv;
+
+	std::uniform_int_distribution<std::size_t> position{0, payload.size()};
+	std::uniform_int_distribution<std::size_t> pick{0, interesting.size() - 1};
+
+	switch (std::uniform_int_distribution{0, 3}(rng)) {
+	case 0:
+		if (!payload.empty())
+			payload[position(rng) % payload.size()] = interesting[pick(rng)];
+		break;
+
+	case 1:
+		payload.insert(position(rng), 1, interesting[pick(rng)]);
+		break;
+
+	case 2:
+		if (!payload.empty())
+			payload.erase(position(rng) % payload.size(), 1);
+		break;
+
+	case 3:
+		payload.resize(position(rng));
+		break;
+	}
+}
+
+} // anonymous namespace
+
+TEST(QmqpParser, Basic)
+{
+	const auto payload = MakeQmqp("Subject: Hello!\r\n\r\nBody\r\n"sv,
+				      "sender@example.com"sv, 2);
+
+	/* feed byte by byte */
+	QmqpParser parser{payload.size()};
+	for (std::size_t i = 1; i < payload.size(); ++i)
+		ASSERT_FALSE(parser.Feed(std::string_view{payload}.substr(0, i)));
+
+	ASSERT_EQ(parser.Feed(payload), QmqpParser::Result::SUCCESS);
+
+	const auto &mail = parser.GetMail();
+	EXPECT_EQ(mail.message, "Subject: Hello!\r\n\r\nBody\r\n"sv);
+	EXPECT_EQ(mail.sender, "sender@example.com"sv);
+	ASSERT_EQ(mail.recipients.size(), 2U);
+	EXPECT_EQ(mail.recipients[0], "rcpt0@example.com"sv);
+	EXPECT_EQ(mail.recipients[1], "rcpt1@example.com"sv);
+}
+
+TEST(QmqpParser, EarlyReject)
+{
+	/* an inner netstring which does not fit into the payload is
+	   rejected right after its header */
+	std::string payload = "999:"s;
+	payload.resize(64, 'x');
+
+	QmqpParser parser{payload.size()};
+	EXPECT_EQ(parser.Feed(std::string_view{payload}.substr(0, 3)),
+		  QmqpParser::Result::MALFORMED);
+}
+
+TEST(QmqpParser, EarlyBadAddress)
+{
+	const auto payload = MakeQmqp("message"sv, "not an address"sv, 1);
+	const auto header = Netstring("message"sv) + Netstring("not an address"sv);
+
+	QmqpParser parser{payload.size()};
+	EXPECT_EQ(parser.Feed(header), QmqpParser::Result::BAD_ADDRESS);
+}
+
+TEST(QmqpParser, LeadingZeroes)
+{
+	/* "00:" is a valid empty netstring, "01:" is not */
+	const auto valid = "00:,"s + Netstring("a@b.de"sv) + Netstring("c@d.de"sv);
+	const auto invalid = "01:x,"s + Netstring("a@b.de"sv) + Netstring("c@d.de"sv);
+
+	std::mt19937 rng{42};
+	CheckDifferential(rng, valid);
+	CheckDifferential(rng, invalid);
+
+	QmqpParser parser{valid.size()};
+	EXPECT_EQ(parser.Feed(valid), QmqpParser::Result::SUCCESS);
+}
+
+TEST(QmqpParser, TooManyRecipients)
+{
+	std::mt19937 rng{42};
+	CheckDifferential(rng, MakeQmqp("message"sv, "sender@example.com"sv,
+					QmqpMail::MAX_RECIPIENTS));
+	CheckDifferential(rng, MakeQmqp("message"sv, "sender@example.com"sv,
+					QmqpMail::MAX_RECIPIENTS + 1));
+
+	/* a bad address after the limit is reported as bad address */
+	CheckDifferential(rng, MakeQmqp("message"sv, "sender@example.com"sv,
+					QmqpMail::MAX_RECIPIENTS) +
+			  Netstring("not an address"sv));
+}
+
+TEST(QmqpParser, Differential)
+{
+	std::mt19937 rng{42};
+	std::uniform_int_distribution<std::size_t> n_recipients{0, 4};
+	std::uniform_int_distribution<unsigned> n_mutations{0, 3};
+
+	for (unsigned i = 0; i < 50000; ++i) {
+		auto payload = MakeQmqp("Subject: foo\n\nbar\n"sv,
+					"sender@example.com"sv,
+					n_recipients(rng));
+
+		for (unsigned j = n_mutations(rng); j > 0; --j)
+			Mutate(rng, payload);
+
+		CheckDifferential(rng, payload);
+	}
+}
+
+TEST(QmqpParser, PartialMessage)
+{
+	const auto payload = MakeQmqp("Subject: foo\n\nbar\n"sv,
+				      "sender@example.com"sv, 1);
+	const std::string_view message = std::string_view{payload}.substr(3, 18);
+
+	QmqpParser parser{payload.size()};
+
+	for (std::size_t i = 1; i <= payload.size(); ++i) {
+		const std::string_view received = std::string_view{payload}.substr(0, i);
+		parser.Feed(received);
+
+		const auto partial = parser.GetPartialMessage(received);
+		if (i < 3) {
+			EXPECT_TRUE(partial.empty());
+		} else {
+			EXPECT_EQ(partial.data(), message.data());
+			EXPECT_EQ(partial, message.substr(0, i - 3));
+		}
+	}
+}
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "SealedMemfd.hxx"
+#include "QmqpMemfd.hxx"
+#include "client/MemfdSubmit.hxx"
+#include "djb/QmqpMail.hxx"
+#include "io/UniqueFileDescriptor.hxx"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+#include <stdexcept>
+#include <string_view>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using std::string_view_literals::operator""sv;
+
+static UniqueFileDescriptor
+CreateMemfd(std::string_view contents)
+{
+	UniqueFileDescriptor fd{AdoptTag{},
+		memfd_create("test", MFD_CLOEXEC|MFD_ALLOW_SEALING)};
+	if (!fd.IsDefined())
+		throw std::runtime_error{"memfd_create() failed"};
+
+	if (write(fd.Get(), contents.data(), contents.size()) != (ssize_t)contents.size())
+		throw std::runtime_error{"write() failed"};
+
+	return fd;
+}
+
+static void
+AddSeals(FileDescriptor fd, int seals)
+{
+	if (fcntl(fd.Get(), F_ADD_SEALS, seals) < 0)
+		throw std::runtime_error{"F_ADD_SEALS failed"};
+}
+
+TEST(SealedMemfd, Sealed)
+{
+	const auto fd = CreateMemfd("hello"sv);
+	AddSeals(fd, QMQP_MEMFD_REQUIRED_SEALS);
+	EXPECT_EQ(CheckSealedMemfd(fd), 5U);
+
+	const SealedMemfd mapping{fd, 5};
+	const std::span<const std::byte> data = mapping;
+	EXPECT_EQ(std::string_view(reinterpret_cast<const char *>(data.data()), data.size()),
+		  "hello"sv);
+}
+
+TEST(SealedMemfd, Unsealed)
+{
+	const auto fd = CreateMemfd("hello"sv);
+	EXPECT_THROW(CheckSealedMemfd(fd), std::runtime_error);
+}
+
+TEST(SealedMemfd, NoWriteSeal)
+{
+	/* without F_SEAL_WRITE, the client could modify the
+	   contents while we're using them */
+	const auto fd = CreateMemfd("hello"sv);
+	AddSeals(fd, F_SEAL_SHRINK|F_SEAL_GROW|F_SEAL_SEAL);
+	EXPECT_THROW(CheckSealedMemfd(fd), std::runtime_error);
+}
+
+TEST(SealedMemfd, NotMemfd)
+{
+	FILE *file = tmpfile();
+	ASSERT_NE(file, nullptr);
+
+	EXPECT_THROW(CheckSealedMemfd(FileDescriptor{fileno(file)}),
+		     std::runtime_error);
+
+	fclose(file);
+}
+
+static void
+CheckRoundTrip(FileDescriptor memfd, std::string_view message,
+	       std::string_view sender,
+	       std::span<const std::string_view> recipients)
+{
+	const std::size_t size = CheckSealedMemfd(memfd);
+	const SealedMemfd mapping{memfd, size};
+
+	QmqpMail mail;
+	ASSERT_EQ(mail.Parse(mapping), QmqpMail::ParseResult::SUCCESS);
+	EXPECT_EQ(mail.message, message);
+	EXPECT_EQ(mail.sender, sender);
+	ASSERT_EQ(mail.recipients.size(), recipients.size());
+	for (std::size_t i = 0; i < recipients.size(); ++i)
+		EXPECT_EQ(mail.recipients[i], recipients[i]);
+}
+
+TEST(SealedMemfd, CreateQmqpMemfd)
+{
+	constexpr auto message = "Subject: Hello!\r\n\r\nBody\r\n"sv;
+	constexpr auto sender = "sender@example.com"sv;
+	static constexpr std::array recipients{
+		"one@example.com"sv,
+		"two@example.com"sv,
+	};
+
+	const auto memfd = CreateQmqpMemfd(message, sender, recipients);
+	CheckRoundTrip(memfd, message, sender, recipients);
+}
+
+TEST(SealedMemfd, CreateQmqpMemfdFromFd)
+{
+	constexpr auto sender = "sender@example.com"sv;
+	static constexpr std::array recipients{"one@example.com"sv};
+
+	/* more than the pipe buffer, so the message arrives in
+	   several chunks */
+	std::string message{"Subject: Hello!\r\n\r\n"};
+	while (message.size() < 256 * 1024)
+		message.append("0123456789abcdef"sv);
+
+	/* also an empty message */
+	for (const std::string_view i : {std::string_view{message}, ""sv}) {
+		FILE *file = tmpfile();
+		ASSERT_NE(file, nullptr);
+		ASSERT_EQ(fwrite(i.data(), 1, i.size(), file), i.size());
+		fflush(file);
+		rewind(file);
+
+		/* a regular file (not a pipe), which cannot be
+		   spliced */
+		const auto memfd = CreateQmqpMemfd(FileDescriptor{fileno(file)},
+						   sender, recipients);
+		fclose(file);
+
+		CheckRoundTrip(memfd, i, sender, recipients);
+	}
+
+	int fds[2];
+	ASSERT_EQ(pipe(fds), 0);
+
+	const pid_t pid = fork();
+	ASSERT_GE(pid, 0);
+
+	if (pid == 0) {
+		close(fds[0]);
+		std::string_view rest = message;
+		while (!rest.empty()) {
+			const auto nbytes = write(fds[1], rest.data(), rest.size());
+			if (nbytes <= 0)
+				_exit(EXIT_FAILURE);
+			rest.remove_prefix(nbytes);
+		}
+		_exit(EXIT_SUCCESS);
+	}
+
+	close(fds[1]);
+	const auto memfd = CreateQmqpMemfd(FileDescriptor{fds[0]},
+					   sender, recipients);
+	close(fds[0]);
+	waitpid(pid, nullptr, 0);
+
+	CheckRoundTrip(memfd, message, sender, recipients);
+}
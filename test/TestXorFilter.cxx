@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-2-Clause
+// Copyright CM4all GmbH
+// author: Max Kellermann <max.kellermann@ionos.com>
+
+#include "util/XorFilter.hxx"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(XorFilter, Empty)
+{
+	const XorFilter empty{};
+	EXPECT_FALSE(empty.MayContain(XorFilter::Hash("foo")));
+
+	std::vector<uint_least64_t> hashes;
+	const XorFilter filter{hashes};
+	EXPECT_FALSE(filter.MayContain(XorFilter::Hash("foo")));
+}
+
+TEST(XorFilter, Small)
+{
+	std::vector<uint_least64_t> hashes{
+		XorFilter::Hash("foo"),
+		XorFilter::Hash("bar"),
+		XorFilter::Hash("foo"), // duplicate
+	};
+
+	const XorFilter filter{hashes};
+	EXPECT_TRUE(filter.MayContain(XorFilter::Hash("foo")));
+	EXPECT_TRUE(filter.MayContain(XorFilter::Hash("bar")));
+}
+
+TEST(XorFilter, Large)
+{
+	constexpr std::size_t n = 100000;
+
+	std::vector<uint_least64_t> hashes;
+	for (std::size_t i = 0; i < n; ++i)
+		hashes.push_back(XorFilter::Hash("user" + std::to_string(i) + "@example.com"));
+
+	const XorFilter filter{hashes};
+	EXPECT_LT(filter.GetMemorySize(), n * 10 / 8 + 64);
+
+	/* no false negatives */
+	for (std::size_t i = 0; i < n; ++i)
+		ASSERT_TRUE(filter.MayContain(XorFilter::Hash("user" + std::to_string(i) + "@example.com")));
+
+	/* the false positive rate should be about 1/256 */
+	std::size_t n_false_positives = 0;
+	for (std::size_t i = n; i < 2 * n; ++i)
+		if (filter.MayContain(XorFilter::Hash("user" + std::to_string(i) + "@example.com")))
+			++n_false_positives;
+
+	EXPECT_LT(n_false_positives, n / 100);
+}
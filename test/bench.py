@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+#
+# End-to-end benchmark: runs qrelay with test/config/bench.lua and
+# submits mails with the "BenchQmqp" load generator, once for each
+# action.  The results are written as JSON to a file named after the
+# version and compared with the newest result of a previous version.
+#
+# Environment variables:
+#
+# - QRELAY_BENCH_RESULTS: directory where results are stored
+#   (default: $XDG_CACHE_HOME/cm4all-qrelay/bench-results, i.e. outside
+#   of the build directory, so results of previous releases survive
+#   a fresh build)
+# - QRELAY_BENCH_CONCURRENCY, QRELAY_BENCH_COUNT, QRELAY_BENCH_SIZE,
+#   QRELAY_BENCH_RECIPIENTS: load parameters
+
+import json
+import os
+import sys
+import signal
+import shutil
+import subprocess
+import time
+
+if len(sys.argv) != 3:
+    print(f"Usage: {sys.argv[0]} BUILD_DIR VERSION", file=sys.stderr)
+    sys.exit(1)
+
+build_directory = sys.argv[1]
+version = sys.argv[2]
+
+test_directory = os.path.dirname(__file__)
+config_directory = os.path.join(test_directory, 'config')
+runtime_directory = os.path.join(build_directory, 'run-bench')
+socket_path = os.path.join(runtime_directory, 'qrelay.socket')
+upstream_path = os.path.join(runtime_directory, 'upstream.socket')
+bench_program = os.path.join(build_directory, 'test', 'BenchQmqp')
+cache_directory = os.getenv('XDG_CACHE_HOME',
+                            os.path.join(os.path.expanduser('~'), '.cache'))
+results_directory = os.getenv('QRELAY_BENCH_RESULTS',
+                              os.path.join(cache_directory, 'cm4all-qrelay',
+                                           'bench-results'))
+
+ACTIONS = ('discard', 'connect', 'exec', 'exec_raw')
+
+load = {
+    'concurrency': int(os.getenv('QRELAY_BENCH_CONCURRENCY', '16')),
+    'count': int(os.getenv('QRELAY_BENCH_COUNT', '2000')),
+    'size': int(os.getenv('QRELAY_BENCH_SIZE', '4096')),
+    'recipients': int(os.getenv('QRELAY_BENCH_RECIPIENTS', '2')),
+}
+
+def wait_for_socket(path: str) -> None:
+    for i in range(100):
+        if os.path.exists(path):
+            return
+        time.sleep(0.05)
+    raise RuntimeError(f"Timeout waiting for {path}")
+
+def get_cpu_seconds(pid: int) -> float:
+    with open(f'/proc/{pid}/stat', 'r') as f:
+        # skip "pid (comm)" because comm may contain spaces
+        fields = f.read().rsplit(')', 1)[1].split()
+    # utime and stime (fields 14 and 15)
+    return (int(fields[11]) + int(fields[12])) / os.sysconf('SC_CLK_TCK')
+
+def get_peak_rss(pid: int) -> int:
+    with open(f'/proc/{pid}/status', 'r') as f:
+        for line in f:
+            if line.startswith('VmHWM:'):
+                return int(line.split()[1]) * 1024
+    return 0
+
+def run_action(action: str) -> dict:
+    try:
+        os.unlink(socket_path)
+    except FileNotFoundError:
+        pass
+
+    process = subprocess.Popen(
+        [
+            os.path.join(build_directory, 'cm4all-qrelay'),
+            '--config', os.path.join(config_directory, 'bench.lua'),
+        ],
+        stdin=subprocess.DEVNULL,
+        env={
+            'QRELAY_SOCKET_PATH': socket_path,
+            'QRELAY_BENCH_ACTION': action,
+            'QRELAY_BENCH_STUB': bench_program,
+            'QRELAY_BENCH_UPSTREAM': upstream_path,
+        },
+    )
+
+    try:
+        wait_for_socket(socket_path)
+
+        cpu_before = get_cpu_seconds(process.pid)
+        output = subprocess.check_output([
+            bench_program, 'load', socket_path,
+            str(load['concurrency']), str(load['count']),
+            str(load['size']), str(load['recipients']),
+        ])
+        cpu_after = get_cpu_seconds(process.pid)
+
+        result = json.loads(output)
+        result['cpu_per_mail'] = (cpu_after - cpu_before) / max(result['mails'], 1)
+        result['peak_rss'] = get_peak_rss(process.pid)
+        return result
+    finally:
+        os.kill(process.pid, signal.SIGTERM)
+        process.wait(10)
+        process.kill()
+
+def find_baseline() -> tuple[str, dict] | None:
+    '''Find the newest result file of a different version.'''
+    candidates = []
+    for name in os.listdir(results_directory):
+        path = os.path.join(results_directory, name)
+        if name.endswith('.json') and name != f'{version}.json':
+            candidates.append((os.path.getmtime(path), name[:-5], path))
+
+    if not candidates:
+        return None
+
+    _, baseline_version, path = max(candidates)
+    with open(path, 'r') as f:
+        return baseline_version, json.load(f)
+
+def print_comparison(baseline_version: str, baseline: dict, results: dict) -> None:
+    print(f"\nChange relative to {baseline_version}:")
+    for action, result in results['actions'].items():
+        old = baseline.get('actions', {}).get(action)
+        if old is None:
+            continue
+
+        def delta(new_value: float, old_value: float) -> str:
+            if old_value == 0:
+                return 'n/a'
+            return f'{(new_value - old_value) * 100 / old_value:+.1f}%'
+
+        print(f"  {action:10} throughput {delta(result['throughput'], old['throughput'])}"
+              f"  p99 {delta(result['latency']['p99'], old['latency']['p99'])}"
+              f"  cpu/mail {delta(result['cpu_per_mail'], old['cpu_per_mail'])}"
+              f"  peak RSS {delta(result['peak_rss'], old['peak_rss'])}")
+
+shutil.rmtree(runtime_directory, ignore_errors=True)
+os.mkdir(runtime_directory)
+os.makedirs(results_directory, exist_ok=True)
+
+upstream = subprocess.Popen([bench_program, 'serve', upstream_path],
+                            stdin=subprocess.DEVNULL)
+
+try:
+    wait_for_socket(upstream_path)
+
+    results = {
+        'version': version,
+        'time': int(time.time()),
+        'load': load,
+        'actions': {},
+    }
+
+    for action in ACTIONS:
+        result = run_action(action)
+        results['actions'][action] = result
+        print(f"{action:10} {result['throughput']:10.1f} mails/s"
+              f"  p50 {result['latency']['p50'] * 1000:.3f} ms"
+              f"  p99 {result['latency']['p99'] * 1000:.3f} ms"
+              f"  cpu/mail {result['cpu_per_mail'] * 1e6:.1f} us"
+              f"  peak RSS {result['peak_rss'] // 1024} kB")
+
+    baseline = find_baseline()
+
+    results_path = os.path.join(results_directory, f'{version}.json')
+    with open(results_path, 'w') as f:
+        json.dump(results, f, indent=2)
+    print(f"\nResults stored in {results_path}")
+
+    if baseline is not None:
+        print_comparison(*baseline, results)
+finally:
+    os.kill(upstream.pid, signal.SIGTERM)
+    upstream.wait(10)
+    shutil.rmtree(runtime_directory, ignore_errors=True)
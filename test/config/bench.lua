@@ -0,0 +1,20 @@
+-- Configuration for test/bench.py; QRELAY_BENCH_ACTION selects the
+-- action which is benchmarked.
+
+local action = os.getenv('QRELAY_BENCH_ACTION')
+local stub = os.getenv('QRELAY_BENCH_STUB')
+local upstream = qmqp_resolve(os.getenv('QRELAY_BENCH_UPSTREAM'))
+
+function handle(m)
+   if action == 'connect' then
+      return m:connect(upstream)
+   elseif action == 'exec' then
+      return m:exec(stub, 'exec')
+   elseif action == 'exec_raw' then
+      return m:exec_raw(stub, 'exec-raw', m.sender, unpack(m.recipients))
+   else
+      return m:discard()
+   end
+end
+
+qmqp_listen(os.getenv('QRELAY_SOCKET_PATH'), handle)
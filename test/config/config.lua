@@ -1,7 +1,48 @@
+local record_program = os.getenv('QRELAY_RECORD_PROGRAM')
+local record_file = os.getenv('QRELAY_RECORD_FILE')
+
+local function record(m, path)
+   return m:exec_raw(record_program, path, m.sender, unpack(m.recipients))
+end
+
+-- raise an error if fanout() accepts any of these bad arguments
+local function check_fanout_arguments(m)
+   local function rejects(t)
+      return not pcall(m.fanout, m, t)
+   end
+
+   local secondary = record(m, '/dev/null')
+
+   assert(rejects({}))
+   assert(rejects({m:discard()}))
+   assert(rejects({m:discard(), 'foo'}))
+   assert(rejects({m:discard(), m:discard()}))
+   assert(rejects({m:discard(), m:reject()}))
+   assert(rejects({m:discard(), m:fanout{m:discard(), secondary}}))
+   assert(rejects({m:fanout{m:discard(), secondary}, secondary}))
+   assert(rejects({m:discard(), secondary, timeout=0}))
+   assert(rejects({m:discard(), secondary, timeout='foo'}))
+   assert(rejects({m:discard(), secondary, foo=1}))
+   assert(rejects({m:discard(), secondary, secondary, secondary,
+                   secondary, secondary, secondary, secondary,
+                   secondary}))
+
+   assert(not rejects({m:discard(), secondary, timeout=1}))
+end
+
 function handle(m)
    m:insert_header('X-Header1', 'Foo')
    m:insert_header('X-Header2', 'Bar')
-   return m:exec_raw(os.getenv('QRELAY_RECORD_PROGRAM'), os.getenv('QRELAY_RECORD_FILE'), m.sender, unpack(m.recipients))
+
+   if m.sender == 'fanout@localhost' then
+      check_fanout_arguments(m)
+      return m:fanout{
+         record(m, record_file),
+         record(m, record_file .. '.secondary'),
+      }
+   end
+
+   return record(m, record_file)
 end
 
 qmqp_listen(os.getenv('QRELAY_SOCKET_PATH'), handle)
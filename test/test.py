@@ -40,27 +40,69 @@ def submit_to_qrelay(socket_path: str, request: bytes) -> bytes:
         response += chunk
     return response
 
-def run_tests(socket_path: str) -> None:
-    sender = 'nobody@localhost'
-    recipients = ('foo@example.com', 'bar@example.com')
-    message = 'Subject: Hello!\n\nhello world\n'
-    expected = f'''{sender}
+def get_response_code(response: bytes) -> str:
+    colon = response.find(b':')
+    if colon < 0 or colon + 1 >= len(response):
+        raise RuntimeError(f"Malformed response {response!r}")
+    return chr(response[colon + 1])
+
+def expected_record(message: str, sender: str, recipients: Iterable[str]) -> str:
+    return f'''{sender}
 {"\n".join(recipients)}
 
 X-Header2: Bar
 X-Header1: Foo
 Received: from PID={os.getpid()} UID={os.geteuid()} with QMQP
-Subject: Hello!
+{message}'''
+
+def read_record(path: str) -> str:
+    with open(path, 'r', encoding='utf-8') as f:
+        return f.read()
+
+def wait_record(path: str, expected: str, timeout: float) -> None:
+    # secondary relays run in the background; wait for them
+    deadline = time.monotonic() + timeout
+    while True:
+        recorded = read_record(path) if os.path.exists(path) else None
+        if recorded == expected:
+            return
+        if time.monotonic() >= deadline:
+            raise RuntimeError(f"Mismatch in {path}\nrecorded={recorded!r}\nexpected={expected!r}")
+        time.sleep(0.05)
 
-hello world
-'''
+def submit(socket_path: str, message: str, sender: str, recipients: Iterable[str]) -> bytes:
+    return submit_to_qrelay(socket_path, encode_qmqp(message.encode('utf-8'), sender.encode('utf-8'), map(lambda x: x.encode('utf-8'), recipients)))
+
+def run_tests(socket_path: str) -> None:
+    sender = 'nobody@localhost'
+    recipients = ('foo@example.com', 'bar@example.com')
+    message = 'Subject: Hello!\n\nhello world\n'
+    expected = expected_record(message, sender, recipients)
     shutil.rmtree(record_file, ignore_errors=True)
-    submit_to_qrelay(socket_path, encode_qmqp(message.encode('utf-8'), sender.encode('utf-8'), map(lambda x: x.encode('utf-8'), recipients)))
-    with open(record_file, 'r', encoding='utf-8') as f:
-        recorded = f.read()
+    submit(socket_path, message, sender, recipients)
+    recorded = read_record(record_file)
     if recorded != expected:
         raise RuntimeError(f"Mismatch\nrecorded={recorded!r}\nexpected={expected!r}")
 
+def run_fanout_tests(socket_path: str) -> None:
+    sender = 'fanout@localhost'
+    recipients = ('foo@example.com',)
+    message = 'Subject: Fanout\n\nhello world\n'
+    expected = expected_record(message, sender, recipients)
+    secondary_file = record_file + '.secondary'
+    for i in (record_file, secondary_file):
+        if os.path.exists(i):
+            os.unlink(i)
+
+    # the handler also checks fanout()'s argument validation and
+    # fails the request if that is broken
+    response = submit(socket_path, message, sender, recipients)
+    if get_response_code(response) != 'K':
+        raise RuntimeError(f"Fanout failed: {response!r}")
+
+    for i in (record_file, secondary_file):
+        wait_record(i, expected, timeout=5)
+
 shutil.rmtree(runtime_directory, ignore_errors=True)
 os.mkdir(runtime_directory)
 
@@ -82,6 +124,7 @@ time.sleep(0.2)
 
 try:
     run_tests(socket_path)
+    run_fanout_tests(socket_path)
 finally:
     os.kill(process.pid, signal.SIGTERM)
     process.wait(10)